@@ -1,5 +1,6 @@
 #include "ai.h"
 #include "game.h"
+#include "search_state.h"
 #include <stdlib.h>
 #include <limits.h>
 
@@ -95,63 +96,30 @@ static position_t find_opponent_head(game_state_t* game, int my_snake_id) {
 }
 
 /**
- * @brief 특정 위치가 안전한지 확인합니다 (충돌 없음)
+ * @brief 미리보기를 통한 안전성 평가
  * 
- * @param game 게임 상태 포인터
- * @param pos 확인할 위치
- * @param snake_id 확인하는 뱀의 ID
- * @return 안전하면 true, 위험하면 false
- */
-static bool is_safe_position(game_state_t* game, position_t pos, int snake_id) {
-    if (!is_valid_position(pos)) return false;
-    
-    char cell = game->map[pos.y][pos.x];
-    if (cell == CELL_OBSTACLE) return false;
-    
-    // 모든 뱀과의 충돌 검사 (자신 포함)
-    for (int i = 0; i < game->num_players; i++) {
-        snake_t* snake = &game->players[i];
-        if (!snake->alive) continue;
-        
-        snake_node_t* current = snake->head;
-        while (current) {
-            // 자신의 꼬리는 제외 (이동할 것이므로)
-            if (i == snake_id && current == snake->tail) {
-                current = current->next;
-                continue;
-            }
-            
-            if (current->pos.x == pos.x && current->pos.y == pos.y) {
-                return false;
-            }
-            current = current->next;
-        }
-    }
-    
-    return true;
-}
-
-/**
- * @brief 미리보기를 통한 위치 안전성 평가
+ * 탐색 상태에서 뱀을 실제로 움직여 보고 되돌리므로, 몸통이 따라오고
+ * 꼬리가 비워지는 것까지 반영됩니다 (할당 없음).
  * 
- * @param game 게임 상태 포인터
- * @param pos 평가할 위치
- * @param depth 미리보기 깊이
+ * @param search 탐색 상태 (평가 후 원래대로 돌아옴)
  * @param snake_id 뱀 ID
- * @return 안전한 이동 경로 수
+ * @param depth 미리보기 깊이
+ * @return 깊이만큼 살아남을 수 있는 다음 이동 수
  */
-static int evaluate_position_safety(game_state_t* game, position_t pos, int depth, int snake_id) {
+static int evaluate_position_safety(search_state_t* search, int snake_id, int depth) {
     if (depth <= 0) return 1;
-    if (!is_safe_position(game, pos, snake_id)) return 0;
     
     int safe_moves = 0;
     
-    // 이 위치에서 가능한 모든 움직임 검사
+    // 현재 위치에서 가능한 모든 움직임 검사 (역방향 제외)
     for (int dir = 0; dir < 4; dir++) {
-        position_t next_pos = get_next_position(pos, (direction_t)dir);
-        if (evaluate_position_safety(game, next_pos, depth - 1, snake_id)) {
+        if (is_opposite_direction(search->snakes[snake_id].direction, (direction_t)dir)) continue;
+        if (!search_make_move(search, snake_id, (direction_t)dir)) continue;
+        
+        if (search->snakes[snake_id].alive && evaluate_position_safety(search, snake_id, depth - 1) > 0) {
             safe_moves++;
         }
+        search_unmake_move(search);
     }
     
     return safe_moves;
@@ -227,6 +195,10 @@ direction_t ai_get_best_move(game_state_t* game, int snake_id, int ai_personalit
     if (params.risk_tolerance < 0.0f) params.risk_tolerance = 0.0f;
     if (params.risk_tolerance > 1.0f) params.risk_tolerance = 1.0f;
     
+    // 연결 리스트 대신 평탄한 탐색 상태에서 안전성 판단과 미리보기 수행
+    search_state_t search;
+    search_state_from_game(&search, game);
+    
     // 무작위성 추가 - 설정된 확률로 무작위 움직임
     if ((float)rand() / (float)RAND_MAX < params.randomness) {
         direction_t random_dirs[4];
@@ -235,7 +207,7 @@ direction_t ai_get_best_move(game_state_t* game, int snake_id, int ai_personalit
         for (int dir = 0; dir < 4; dir++) {
             if (!is_opposite_direction(snake->direction, (direction_t)dir)) {
                 position_t next_pos = get_next_position(snake->head->pos, (direction_t)dir);
-                if (is_safe_position(game, next_pos, snake_id)) {
+                if (search_is_free(&search, next_pos)) {
                     random_dirs[valid_count++] = (direction_t)dir;
                 }
             }
@@ -265,14 +237,16 @@ direction_t ai_get_best_move(game_state_t* game, int snake_id, int ai_personalit
         position_t next_pos = get_next_position(snake->head->pos, test_dir);
         
         // 즉시 안전성 검사
-        if (!is_safe_position(game, next_pos, snake_id)) {
+        if (!search_is_free(&search, next_pos)) {
             continue;
         }
         
         int score = 0;
         
-        // 1. 안전성 평가 (기본 가중치)
-        int safety_score = evaluate_position_safety(game, next_pos, params.look_ahead_depth, snake_id);
+        // 1. 안전성 평가 (기본 가중치) - 이 방향으로 움직인 뒤의 미리보기
+        search_make_move(&search, snake_id, test_dir);
+        int safety_score = evaluate_position_safety(&search, snake_id, params.look_ahead_depth);
+        search_unmake_move(&search);
         score += safety_score * 100;
         
         // 2. 사과까지의 거리 (음식 우선순위에 따라)
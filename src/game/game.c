@@ -1,5 +1,7 @@
 #include "game.h"
 #include "ai.h"
+#include "motion.h"
+#include "replay.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -104,8 +106,6 @@ static snake_node_t* create_snake_node(position_t pos) {
     snake_node_t* node = malloc(sizeof(snake_node_t));
     if (node) {
         node->pos = pos;
-        node->smooth_pos.x = (float)pos.x;
-        node->smooth_pos.y = (float)pos.y;
         node->next = NULL;
     }
     return node;
@@ -128,14 +128,68 @@ static void free_snake(snake_t* snake) {
 }
 
 /**
- * @brief 게임을 초기화합니다
+ * @brief 게임을 실시간 시계로 초기화합니다
  * 
  * @param game 게임 상태 포인터
  * @param mode 게임 모드
  * @return 초기화 성공시 true, 실패시 false
  */
 bool game_init(game_state_t* game, game_mode_t mode) {
-    if (!game) {
+    game_clock_t clock;
+    game_clock_init(&clock, GAME_CLOCK_REAL);
+    return game_init_with_clock(game, mode, &clock);
+}
+
+/**
+ * @brief 주어진 시간 소스로 게임을 초기화합니다
+ * 
+ * 모든 게임 시간(시작/일시정지/틱 시각)은 이 시계로 측정됩니다.
+ * 난수 시드는 현재 시각에서 정합니다.
+ * 
+ * @param game 게임 상태 포인터
+ * @param mode 게임 모드
+ * @param clock 사용할 게임 시계 (복사됨)
+ * @return 초기화 성공시 true, 실패시 false
+ */
+bool game_init_with_clock(game_state_t* game, game_mode_t mode, const game_clock_t* clock) {
+    uint64_t now = platform_get_time_us();
+    return game_init_with_seed(game, mode, clock, (uint32_t)(now ^ (now >> 32)));
+}
+
+/**
+ * @brief 게임 전용 난수 생성기에서 범위 안의 정수를 뽑습니다
+ * 
+ * 시뮬레이션이 쓰는 난수는 모두 여기서 나오므로, 같은 시드로 시작해
+ * 같은 방향 전환을 적용하면 사과/장애물 위치까지 똑같이 재현됩니다.
+ * (AI처럼 시뮬레이션 밖에서 쓰는 난수와는 분리되어 있음)
+ * 
+ * @param game 게임 상태 포인터
+ * @param min 최솟값
+ * @param max 최댓값 (포함)
+ * @return min 이상 max 이하의 정수
+ */
+static int game_random(game_state_t* game, int min, int max) {
+    uint32_t x = game->rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    game->rng_state = x;
+    return min + (int)(x % (uint32_t)(max - min + 1));
+}
+
+/**
+ * @brief 시간 소스와 난수 시드를 지정해 게임을 초기화합니다
+ * 
+ * 리플레이 재생처럼 기록된 게임을 그대로 다시 만들 때 사용합니다.
+ * 
+ * @param game 게임 상태 포인터
+ * @param mode 게임 모드
+ * @param clock 사용할 게임 시계 (복사됨)
+ * @param seed 난수 시드
+ * @return 초기화 성공시 true, 실패시 false
+ */
+bool game_init_with_seed(game_state_t* game, game_mode_t mode, const game_clock_t* clock, uint32_t seed) {
+    if (!game || !clock) {
         return false;
     }
     
@@ -153,15 +207,22 @@ bool game_init(game_state_t* game, game_mode_t mode) {
     game->num_players = 0;
     game->game_over = false;
     game->winner_id = -1;
-    game->game_start_time = platform_get_time_ms();
+    game->clock = *clock;
+    game->game_start_time = game_clock_now_ms(&game->clock);
     game->pause_start_time = 0;
     game->total_pause_time = 0;
     game->game_speed = 150; // 움직임당 밀리초
     game->smooth_motion_enabled = true;
     game->motion_interpolation = 0.0f;
     game->game_mutex = platform_create_mutex();
+    input_queue_init(&game->input_queue);
+    game->last_tick_time = 0;
     game->apples_eaten = 0;
     game->actual_play_time = 0;
+    game->seed = seed;
+    game->rng_state = seed ? seed : 0x9E3779B9u;  // xorshift 상태는 0이면 안 됨
+    game->tick_count = 0;
+    game->recorder = NULL;
     
     // 모드에 따른 플레이어 초기화
     switch (mode) {
@@ -208,18 +269,19 @@ void game_toggle_pause(game_state_t* game) {
     if (game->state == GAME_STATE_PLAYING) {
         // 게임 일시정지
         game->state = GAME_STATE_PAUSED;
-        game->pause_start_time = platform_get_time_ms();
+        game->pause_start_time = game_clock_now_ms(&game->clock);
     } else if (game->state == GAME_STATE_PAUSED) {
         // 게임 재개
         game->state = GAME_STATE_PLAYING;
         
         // 일시정지 시간 누적
         if (game->pause_start_time > 0) {
-            game->total_pause_time += platform_get_time_ms() - game->pause_start_time;
+            game->total_pause_time += game_clock_now_ms(&game->clock) - game->pause_start_time;
             game->pause_start_time = 0;
         }
     }
     
+    game_publish_snapshot(game);
     platform_unlock_mutex(game->game_mutex);
 }
 
@@ -242,7 +304,8 @@ bool game_is_paused(const game_state_t* game) {
 uint64_t game_get_play_time(game_state_t* game) {
     if (!game) return 0;
     
-    uint64_t current_time = platform_get_time_ms();
+    // 게임이 끝났으면 종료 시점에서 시간을 멈춤
+    uint64_t current_time = game->game_over ? game->game_end_time : game_clock_now_ms(&game->clock);
     uint64_t total_time = current_time - game->game_start_time;
     uint64_t pause_time = game->total_pause_time;
     
@@ -251,50 +314,151 @@ uint64_t game_get_play_time(game_state_t* game) {
         pause_time += current_time - game->pause_start_time;
     }
     
-    return total_time - pause_time;
+    return game->play_time_offset + total_time - pause_time;
+}
+
+/**
+ * @brief 뱀 하나의 렌더링 정보를 스냅샷에 복사합니다
+ * 
+ * 연결 리스트를 한 번 순회하며 보간용 SoA 배열과 칸 소유자 격자를 채웁니다.
+ * 
+ * @param snapshot 채울 스냅샷
+ * @param snake 복사할 뱀
+ */
+static void snapshot_copy_snake(game_snapshot_t* snapshot, const snake_t* snake) {
+    snake_snapshot_t* view = &snapshot->players[snake->id];
+    view->alive = snake->alive;
+    view->length = snake->length;
+    view->score = snake->score;
+    view->color = snake->color;
+    view->head_color = snake->head_color;
+    
+    int count = 0;
+    for (const snake_node_t* node = snake->head; node && count < MAX_SNAKE_LENGTH; node = node->next) {
+        view->trail_x[count] = (float)node->pos.x;
+        view->trail_y[count] = (float)node->pos.y;
+        
+        // 죽은 뱀은 그리지 않으므로 소유자도 기록하지 않음
+        if (snake->alive) {
+            snapshot->owner[node->pos.y][node->pos.x] = (int8_t)snake->id;
+        }
+        count++;
+    }
+    view->trail_x[count] = (float)snake->last_tail_pos.x;
+    view->trail_y[count] = (float)snake->last_tail_pos.y;
+}
+
+/**
+ * @brief 렌더러용 스냅샷 버퍼를 할당하고 첫 스냅샷을 발행합니다
+ * 
+ * 스냅샷은 맵과 뱀 궤적을 담아 게임 상태 대부분을 차지하므로, 화면에 그리는
+ * 게임에서만 붙입니다. 붙이지 않은 게임은 틱마다 스냅샷을 복사하지 않습니다.
+ * 시뮬레이션 스레드를 시작하기 전에 호출해야 합니다.
+ * 
+ * @param game 게임 상태 포인터 (game_init 뒤)
+ * @return 성공하면 true
+ */
+bool game_attach_renderer(game_state_t* game) {
+    if (!game) return false;
+    
+    if (!game->snapshots) {
+        game->snapshots = calloc(GAME_SNAPSHOT_COUNT, sizeof(game_snapshot_t));
+        if (!game->snapshots) return false;
+        game->snapshot_back = 0;
+        game->snapshot_ready = 1;
+        game->snapshot_front = 2;
+    }
+    
+    game_publish_snapshot(game);
+    return true;
 }
 
 /**
- * @brief 부드러운 모션을 업데이트합니다
+ * @brief 현재 게임 상태를 스냅샷으로 발행합니다
+ * 
+ * 쓰기 버퍼를 채운 뒤 발행 대기 버퍼와 원자적으로 맞바꿉니다.
+ * 발행 쪽은 하나여야 하므로 game_mutex를 잡은 상태(또는 시뮬레이션 스레드가
+ * 없는 상태)에서 호출해야 합니다. 렌더러를 기다리는 일은 없습니다.
  * 
  * @param game 게임 상태 포인터
- * @param delta_time 프레임 간격 (초)
  */
-void game_update_smooth_motion(game_state_t* game, float delta_time) {
-    if (!game || !game->smooth_motion_enabled) return;
+void game_publish_snapshot(game_state_t* game) {
+    if (!game || !game->snapshots) return;
+    
+    game_snapshot_t* snapshot = &game->snapshots[game->snapshot_back];
     
-    // 각 플레이어의 부드러운 모션 업데이트
+    memcpy(snapshot->map, game->map, sizeof(snapshot->map));
+    memset(snapshot->owner, -1, sizeof(snapshot->owner));
     for (int i = 0; i < game->num_players; i++) {
-        snake_t* snake = &game->players[i];
+        snapshot_copy_snake(snapshot, &game->players[i]);
+    }
+    
+    snapshot->num_players = game->num_players;
+    snapshot->mode = game->mode;
+    snapshot->state = game->state;
+    snapshot->game_over = game->game_over;
+    snapshot->winner_id = game->winner_id;
+    snapshot->game_speed = game->game_speed;
+    snapshot->obstacles_count = game->obstacles_count;
+    snapshot->smooth_motion_enabled = game->smooth_motion_enabled;
+    snapshot->tick_time = game->last_tick_time;
+    snapshot->play_time = game_get_play_time(game);
+    snapshot->tick_stats = game->tick_stats;
+    
+    // 채운 버퍼를 발행하고, 이전 발행 대기 버퍼를 다음 쓰기 버퍼로 가져옴
+    int32_t previous = platform_atomic_exchange(&game->snapshot_ready,
+                                                game->snapshot_back | SNAPSHOT_FRESH);
+    game->snapshot_back = previous & SNAPSHOT_INDEX_MASK;
+}
+
+/**
+ * @brief 렌더링할 최신 스냅샷을 가져옵니다 (잠금 없음)
+ * 
+ * 새로 발행된 스냅샷이 있으면 읽기 버퍼와 맞바꾸고, 없으면 직전에 읽던
+ * 스냅샷을 그대로 반환합니다. 렌더러 스레드 하나에서만 호출해야 합니다.
+ * 
+ * @param game 게임 상태 포인터
+ * @return 렌더러 전용 스냅샷 포인터 (렌더러를 붙이지 않았으면 NULL)
+ */
+game_snapshot_t* game_acquire_snapshot(game_state_t* game) {
+    if (!game || !game->snapshots) return NULL;
+    
+    if (platform_atomic_load(&game->snapshot_ready) & SNAPSHOT_FRESH) {
+        int32_t fresh = platform_atomic_exchange(&game->snapshot_ready, game->snapshot_front);
+        game->snapshot_front = fresh & SNAPSHOT_INDEX_MASK;
+    }
+    
+    return &game->snapshots[game->snapshot_front];
+}
+
+/**
+ * @brief 스냅샷의 부드러운 모션 위치를 업데이트합니다
+ * 
+ * 스냅샷을 만든 틱 이후 흐른 시간으로 이동 진행도(0.0 ~ 1.0)를 구해
+ * 각 마디의 보간 위치를 계산합니다. 렌더러 쪽에서 호출합니다.
+ * 
+ * @param snapshot 렌더러가 가져온 스냅샷
+ * @param current_time 현재 시간 (밀리초)
+ */
+void game_update_smooth_motion(game_snapshot_t* snapshot, uint64_t current_time) {
+    if (!snapshot || !snapshot->smooth_motion_enabled) return;
+    
+    // 한 틱(game_speed ms) 동안 0에서 1까지 진행
+    // (시계를 틱보다 먼저 읽었다면 current_time이 tick_time보다 작을 수 있으므로 뺄셈 전에 확인)
+    float progress = 1.0f;
+    if (current_time <= snapshot->tick_time) {
+        progress = 0.0f;
+    } else if (current_time < snapshot->tick_time + (uint64_t)snapshot->game_speed) {
+        progress = (float)(current_time - snapshot->tick_time) / (float)snapshot->game_speed;
+    }
+    
+    for (int i = 0; i < snapshot->num_players; i++) {
+        snake_snapshot_t* snake = &snapshot->players[i];
         if (!snake->alive) continue;
         
-        // 모션 진행도 업데이트
-        float motion_speed = 60.0f / (float)game->game_speed; // 속도에 따른 보간 속도
-        snake->move_progress += delta_time * motion_speed;
-        if (snake->move_progress > 1.0f) {
-            snake->move_progress = 1.0f;
-        }
-        
-        // 각 노드의 부드러운 위치 업데이트
-        snake_node_t* current = snake->head;
-        snake_node_t* prev = NULL;
-        
-        while (current) {
-            if (prev == NULL) {
-                // 머리는 이동 진행도에 따라 보간
-                position_t target_pos = current->pos;
-                current->smooth_pos.x = lerp(current->smooth_pos.x, (float)target_pos.x, 0.3f);
-                current->smooth_pos.y = lerp(current->smooth_pos.y, (float)target_pos.y, 0.3f);
-            } else {
-                // 몸통은 앞 노드를 따라감
-                float follow_speed = 0.2f;
-                current->smooth_pos.x = lerp(current->smooth_pos.x, prev->smooth_pos.x, follow_speed);
-                current->smooth_pos.y = lerp(current->smooth_pos.y, prev->smooth_pos.y, follow_speed);
-            }
-            
-            prev = current;
-            current = current->next;
-        }
+        // 각 마디는 직전 틱에 뒤따르던 마디의 자리에서 현재 자리로 미끄러짐
+        motion_lerp_trail(snake->trail_x, snake->smooth_x, snake->length, progress);
+        motion_lerp_trail(snake->trail_y, snake->smooth_y, snake->length, progress);
     }
 }
 
@@ -308,7 +472,274 @@ void game_update_statistics(game_state_t* game) {
     
     game->actual_play_time = game_get_play_time(game);
     
-    // 메모리에서만 통계 유지 (파일 저장 안함)
+    // 경기 결과의 영구 기록은 score_store.h가 맡음 (main이 게임 오버 후 추가)
+}
+
+/**
+ * @brief 틱 하나가 예정 시각보다 늦은 정도를 기록합니다
+ * 
+ * 시뮬레이션 루프가 game_update 직전에 호출하므로, 기록한 값은 같은 틱의
+ * 스냅샷과 함께 렌더러에 전달됩니다.
+ * 
+ * @param game 게임 상태 포인터
+ * @param jitter_us 예정 시각 대비 지연 (마이크로초)
+ */
+void game_record_tick_jitter(game_state_t* game, uint64_t jitter_us) {
+    if (!game) return;
+    
+    tick_stats_t* stats = &game->tick_stats;
+    stats->ticks++;
+    stats->last_jitter_us = jitter_us;
+    stats->total_jitter_us += jitter_us;
+    if (jitter_us > stats->max_jitter_us) {
+        stats->max_jitter_us = jitter_us;
+    }
+    if (jitter_us > TICK_DEADLINE_SLACK_US) {
+        stats->deadline_misses++;
+    }
+}
+
+/**
+ * @brief FNV-1a 해시에 바이트열을 더합니다
+ */
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief 시뮬레이션 결과를 나타내는 상태 해시를 계산합니다
+ * 
+ * 맵, 틱 수, 난수 상태와 각 뱀의 몸통/점수/생존 여부를 포함하며,
+ * 시각이나 통계처럼 실행 환경에 따라 달라지는 값은 제외합니다.
+ * 리플레이 재생 결과가 원래 게임과 같은지 확인할 때 사용합니다.
+ * 
+ * @param game 게임 상태 포인터
+ * @return 64비트 해시
+ */
+uint64_t game_state_hash(const game_state_t* game) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    if (!game) return hash;
+    
+    hash = hash_bytes(hash, game->map, sizeof(game->map));
+    hash = hash_bytes(hash, &game->tick_count, sizeof(game->tick_count));
+    hash = hash_bytes(hash, &game->rng_state, sizeof(game->rng_state));
+    
+    for (int i = 0; i < game->num_players; i++) {
+        const snake_t* snake = &game->players[i];
+        int32_t fields[4] = {snake->length, snake->score, snake->alive, (int32_t)snake->direction};
+        hash = hash_bytes(hash, fields, sizeof(fields));
+        
+        for (const snake_node_t* node = snake->head; node; node = node->next) {
+            int32_t pos[2] = {node->pos.x, node->pos.y};
+            hash = hash_bytes(hash, pos, sizeof(pos));
+        }
+    }
+    return hash;
+}
+
+// 직렬화용 리틀 엔디언 읽기/쓰기
+static uint8_t* put_u16(uint8_t* out, uint32_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    return out + 2;
+}
+
+static uint8_t* put_u32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (uint8_t)(value >> (8 * i));
+    return out + 4;
+}
+
+static uint32_t get_u16(const uint8_t** in) {
+    uint32_t value = (uint32_t)(*in)[0] | (uint32_t)(*in)[1] << 8;
+    *in += 2;
+    return value;
+}
+
+static uint32_t get_u32(const uint8_t** in) {
+    uint32_t value = (uint32_t)(*in)[0] | (uint32_t)(*in)[1] << 8 |
+                     (uint32_t)(*in)[2] << 16 | (uint32_t)(*in)[3] << 24;
+    *in += 4;
+    return value;
+}
+
+/**
+ * @brief 시뮬레이션 상태를 바이트열로 직렬화합니다
+ * 
+ * 틱 진행에 필요한 값(맵, 난수 상태, 뱀 몸통과 점수 등)만 담고,
+ * 시각/통계/스냅샷/뮤텍스처럼 실행 환경에 속한 값은 제외합니다.
+ * 
+ * 형식 (리틀 엔디언): 틱 u32 | 난수 상태 u32 | 시드 u32 | 속도 u16 |
+ * 사과 수 u16 | 장애물 수 u16 | 먹은 사과 u32 | 모드 u8 | 상태 u8 |
+ * 종료 u8 | 승자 s8 | 플레이어 수 u8 | 맵 |
+ * 뱀마다 (유형 u8 | 방향 u8 | 생존 u8 | 점수 u32 | 길이 u16 | 머리부터 (x u8, y u8)...)
+ * 
+ * @param game 게임 상태 포인터
+ * @param out 출력 버퍼
+ * @param capacity 출력 버퍼 크기 (GAME_STATE_MAX_SERIALIZED_SIZE면 항상 충분)
+ * @return 쓴 바이트 수, 버퍼가 부족하면 0
+ */
+size_t game_serialize_state(const game_state_t* game, uint8_t* out, size_t capacity) {
+    if (!game || !out) return 0;
+    
+    size_t needed = GAME_STATE_HEADER_SIZE + sizeof(game->map);
+    for (int i = 0; i < game->num_players; i++) {
+        needed += GAME_STATE_SNAKE_HEADER_SIZE + (size_t)game->players[i].length * 2;
+    }
+    if (needed > capacity) return 0;
+    
+    uint8_t* cursor = out;
+    cursor = put_u32(cursor, game->tick_count);
+    cursor = put_u32(cursor, game->rng_state);
+    cursor = put_u32(cursor, game->seed);
+    cursor = put_u16(cursor, (uint32_t)game->game_speed);
+    cursor = put_u16(cursor, (uint32_t)game->apples_count);
+    cursor = put_u16(cursor, (uint32_t)game->obstacles_count);
+    cursor = put_u32(cursor, (uint32_t)game->apples_eaten);
+    *cursor++ = (uint8_t)game->mode;
+    *cursor++ = (uint8_t)game->state;
+    *cursor++ = game->game_over ? 1 : 0;
+    *cursor++ = (uint8_t)(int8_t)game->winner_id;
+    *cursor++ = (uint8_t)game->num_players;
+    
+    memcpy(cursor, game->map, sizeof(game->map));
+    cursor += sizeof(game->map);
+    
+    for (int i = 0; i < game->num_players; i++) {
+        const snake_t* snake = &game->players[i];
+        *cursor++ = (uint8_t)snake->type;
+        *cursor++ = (uint8_t)snake->direction;
+        *cursor++ = snake->alive ? 1 : 0;
+        cursor = put_u32(cursor, (uint32_t)snake->score);
+        cursor = put_u16(cursor, (uint32_t)snake->length);
+        
+        for (const snake_node_t* node = snake->head; node; node = node->next) {
+            *cursor++ = (uint8_t)node->pos.x;
+            *cursor++ = (uint8_t)node->pos.y;
+        }
+    }
+    
+    return (size_t)(cursor - out);
+}
+
+/**
+ * @brief 맵에 올 수 있는 칸 값인지 확인합니다
+ */
+static bool is_map_cell(uint8_t cell) {
+    return cell == CELL_EMPTY || cell == CELL_APPLE || cell == CELL_OBSTACLE ||
+           cell == CELL_SNAKE_HEAD || cell == CELL_SNAKE_BODY;
+}
+
+/**
+ * @brief 직렬화된 시뮬레이션 상태를 복원합니다
+ * 
+ * game은 이미 초기화되어 있어야 하며(뮤텍스, 시계 등은 그대로 유지),
+ * 기존 뱀은 해제하고 기록된 몸통으로 다시 만듭니다. 예약된 방향은
+ * 현재 방향으로 맞추므로 리플레이 재생과 같은 상태가 됩니다.
+ * 리플레이 파일처럼 믿을 수 없는 입력을 받으므로 모드와 플레이어 수, 맵 칸 값,
+ * 몸통 좌표를 모두 확인하고 하나라도 어긋나면 거부합니다.
+ * 
+ * @param game 초기화된 게임 상태 포인터
+ * @param data 직렬화된 데이터
+ * @param size 데이터 크기
+ * @return 형식이 올바르면 true
+ */
+bool game_deserialize_state(game_state_t* game, const uint8_t* data, size_t size) {
+    if (!game || !data || size < GAME_STATE_HEADER_SIZE + sizeof(game->map)) return false;
+    
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+    
+    uint32_t tick_count = get_u32(&cursor);
+    uint32_t rng_state = get_u32(&cursor);
+    uint32_t seed = get_u32(&cursor);
+    int game_speed = (int)get_u16(&cursor);
+    int apples_count = (int)get_u16(&cursor);
+    int obstacles_count = (int)get_u16(&cursor);
+    int apples_eaten = (int)get_u32(&cursor);
+    game_mode_t mode = (game_mode_t)*cursor++;
+    game_state_enum_t state = (game_state_enum_t)*cursor++;
+    bool game_over = *cursor++ != 0;
+    int winner_id = (int8_t)*cursor++;
+    int num_players = *cursor++;
+    
+    // 파일에서 온 값이므로 뱀을 건드리기 전에 모드/상태와 맵을 모두 확인
+    if (mode > GAME_MODE_VS_AI_HARD || num_players != (mode == GAME_MODE_SINGLE ? 1 : 2) ||
+        state > GAME_STATE_GAME_OVER || winner_id < -1 || winner_id >= num_players) {
+        return false;
+    }
+    
+    const uint8_t* map = cursor;
+    cursor += sizeof(game->map);
+    for (const uint8_t* cell = map; cell < cursor; cell++) {
+        if (!is_map_cell(*cell)) return false;
+    }
+    
+    for (int i = 0; i < game->num_players; i++) {
+        free_snake(&game->players[i]);
+    }
+    game->num_players = num_players;  // 도중에 실패해도 game_cleanup이 만든 만큼 해제
+    
+    for (int i = 0; i < num_players; i++) {
+        snake_t* snake = &game->players[i];
+        if (end - cursor < GAME_STATE_SNAKE_HEADER_SIZE) return false;
+        
+        snake->id = i;
+        if (*cursor > PLAYER_AI_HARD) return false;
+        snake->type = (player_type_t)*cursor++;
+        snake->direction = (direction_t)(*cursor++ & 0x3);
+        snake->next_direction = snake->direction;
+        snake->alive = *cursor++ != 0;
+        snake->score = (int)get_u32(&cursor);
+        int length = (int)get_u16(&cursor);
+        snake->color = player_colors[i];
+        snake->head_color = player_head_colors[i];
+        if (length < 1 || length > MAX_SNAKE_LENGTH || end - cursor < length * 2) return false;
+        
+        snake_node_t* prev = NULL;
+        for (int n = 0; n < length; n++) {
+            position_t pos = {cursor[0], cursor[1]};
+            cursor += 2;
+            if (!is_valid_position(pos)) {
+                free_snake(snake);
+                return false;
+            }
+            
+            snake_node_t* node = create_snake_node(pos);
+            if (!node) {
+                free_snake(snake);
+                return false;
+            }
+            if (prev) {
+                prev->next = node;
+            } else {
+                snake->head = node;
+            }
+            prev = node;
+        }
+        snake->tail = prev;
+        snake->length = length;
+        snake->last_pos = snake->head->pos;
+        snake->last_tail_pos = snake->tail->pos;
+    }
+    
+    memcpy(game->map, map, sizeof(game->map));
+    game->tick_count = tick_count;
+    game->rng_state = rng_state;
+    game->seed = seed;
+    game->game_speed = game_speed;
+    game->apples_count = apples_count;
+    game->obstacles_count = obstacles_count;
+    game->apples_eaten = apples_eaten;
+    game->mode = mode;
+    game->state = state;
+    game->game_over = game_over;
+    game->winner_id = winner_id;
+    return true;
 }
 
 /**
@@ -327,6 +758,8 @@ void game_cleanup(game_state_t* game) {
         free_snake(&game->players[i]);
     }
     
+    free(game->snapshots);
+    game->snapshots = NULL;
     platform_destroy_mutex(game->game_mutex);
 }
 
@@ -351,8 +784,6 @@ void game_add_player(game_state_t* game, player_type_t type) {
     snake->alive = true;
     snake->color = player_colors[id];
     snake->head_color = player_head_colors[id];
-    snake->move_progress = 0.0f;
-    snake->last_pos = (position_t){0, 0};
     
     // 플레이어별 시작 위치 설정 (대전 모드 고려)
     position_t start_positions[MAX_PLAYERS] = {
@@ -387,6 +818,7 @@ void game_add_player(game_state_t* game, player_type_t type) {
         }
         
         prev_node = node;
+        snake->last_tail_pos = pos;
         
         // 맵에 표시
         if (i == 0) {
@@ -396,13 +828,198 @@ void game_add_player(game_state_t* game, player_type_t type) {
         }
     }
     
+    snake->last_pos = snake->head->pos;
+    
     // 플레이어 수 증가
     game->num_players++;
 }
 
+/**
+ * @brief 입력 큐에서 이번 틱에 적용할 방향 전환을 꺼냅니다
+ * 
+ * 플레이어마다 한 틱에 한 번만 방향을 바꾸고, 남은 입력은 다음 틱으로
+ * 미룹니다. 그래서 한 틱 안에 빠르게 누른 두 번의 방향 전환도 잃지 않고,
+ * 두 번 꺾어 역방향으로 들어가는 일도 없습니다. 현재 방향과 같거나 반대인
+ * 입력은 효과가 없으므로 버립니다.
+ * 
+ * @param game 게임 상태 포인터
+ */
+static void apply_queued_turns(game_state_t* game) {
+    bool turned[MAX_PLAYERS] = {false};
+    input_event_t event;
+    
+    while (input_queue_peek(&game->input_queue, &event)) {
+        if (event.player_id < game->num_players && turned[event.player_id]) {
+            break;  // 이 플레이어는 이번 틱에 이미 방향을 바꿈
+        }
+        input_queue_pop(&game->input_queue);
+        
+        if (event.player_id >= game->num_players) continue;
+        
+        snake_t* snake = &game->players[event.player_id];
+        direction_t dir = (direction_t)event.direction;
+        if (!snake->alive || dir == snake->direction || is_opposite_direction(snake->direction, dir)) {
+            continue;
+        }
+        
+        snake->next_direction = dir;
+        turned[event.player_id] = true;
+    }
+}
+
+/**
+ * @brief 한 뱀이 이번 틱에 하려는 이동
+ */
+typedef struct {
+    bool active;                   // 이번 틱에 움직이는 뱀인지 (살아 있었는지)
+    direction_t direction;         // 적용할 방향
+    position_t next_pos;           // 이동할 머리 위치
+    bool dies;                     // 이동하면 죽는지
+    bool grows;                    // 사과를 먹어 길어지는지
+} move_intent_t;
+
+/**
+ * @brief 이전 틱 상태만 읽어 뱀 하나의 이동 의도를 계산합니다 (1단계)
+ * 
+ * 게임 상태를 바꾸지 않으므로 뱀마다 독립적으로(병렬로도) 호출할 수 있고,
+ * 결과가 플레이어 순서에 좌우되지 않습니다. 충돌은 이동 전 맵을 기준으로
+ * 판정하므로 이번 틱에 비워질 꼬리 칸도 막힌 칸으로 봅니다.
+ * 
+ * @param game 게임 상태 포인터 (읽기 전용)
+ * @param player_id 플레이어 인덱스
+ * @param intent 계산 결과
+ */
+static void compute_move_intent(const game_state_t* game, int player_id, move_intent_t* intent) {
+    const snake_t* snake = &game->players[player_id];
+    
+    memset(intent, 0, sizeof(*intent));
+    if (!snake->alive) return;
+    intent->active = true;
+    
+    // 방향 업데이트 (역방향으로는 이동 불가)
+    intent->direction = snake->direction;
+    if (!is_opposite_direction(snake->direction, snake->next_direction)) {
+        intent->direction = snake->next_direction;
+    }
+    
+    // 다음 머리 위치 계산 및 벽 충돌 검사
+    intent->next_pos = get_next_position(snake->head->pos, intent->direction);
+    if (!is_valid_position(intent->next_pos)) {
+        intent->dies = true;
+        return;
+    }
+    
+    // 다음 위치의 내용물 확인
+    char cell = game->map[intent->next_pos.y][intent->next_pos.x];
+    if (cell == CELL_SNAKE_HEAD || cell == CELL_SNAKE_BODY || cell == CELL_OBSTACLE) {
+        intent->dies = true;
+    } else if (cell == CELL_APPLE) {
+        intent->grows = true;
+    }
+}
+
+/**
+ * @brief 여러 뱀의 이동 의도 사이의 충돌을 결정적으로 정리합니다 (2단계)
+ * 
+ * 같은 칸으로 들어가려는 머리들은 배열 순서와 관계없이 모두 죽습니다
+ * (같은 사과를 노린 경우도 마찬가지).
+ * 
+ * @param intents 플레이어별 이동 의도
+ * @param count 플레이어 수
+ */
+static void resolve_move_conflicts(move_intent_t* intents, int count) {
+    bool contested[MAX_PLAYERS] = {false};
+    
+    for (int i = 0; i < count; i++) {
+        if (!intents[i].active || !is_valid_position(intents[i].next_pos)) continue;
+        for (int j = i + 1; j < count; j++) {
+            if (!intents[j].active) continue;
+            if (intents[i].next_pos.x == intents[j].next_pos.x &&
+                intents[i].next_pos.y == intents[j].next_pos.y) {
+                contested[i] = true;
+                contested[j] = true;
+            }
+        }
+    }
+    
+    for (int i = 0; i < count; i++) {
+        if (contested[i]) {
+            intents[i].dies = true;
+        }
+    }
+}
+
+/**
+ * @brief 정리된 이동 의도를 뱀 하나에 적용합니다
+ * 
+ * @param game 게임 상태 포인터
+ * @param snake 움직일 뱀
+ * @param intent 충돌 정리가 끝난 이동 의도
+ */
+static void apply_move_intent(game_state_t* game, snake_t* snake, const move_intent_t* intent) {
+    snake->direction = intent->direction;
+    
+    // 마지막 위치 저장 (부드러운 모션용)
+    snake->last_pos = snake->head->pos;
+    
+    if (intent->dies) {
+        snake->alive = false;
+        return;
+    }
+    
+    // 뱀 이동
+    snake_node_t* new_head = create_snake_node(intent->next_pos);
+    if (!new_head) {
+        snake->alive = false;
+        return;
+    }
+    
+    // 맵 업데이트 - 기존 머리를 몸통으로 변경
+    game->map[snake->head->pos.y][snake->head->pos.x] = CELL_SNAKE_BODY;
+    
+    // 새 머리 추가
+    new_head->next = snake->head;
+    snake->head = new_head;
+    snake->length++;
+    
+    // 새 머리를 맵에 표시
+    game->map[intent->next_pos.y][intent->next_pos.x] = CELL_SNAKE_HEAD;
+    
+    // 꼬리 보간 출발점 - 성장하면 꼬리는 제자리에 머묾
+    snake->last_tail_pos = snake->tail->pos;
+    
+    // 성장하지 않을 때 꼬리 제거
+    if (!intent->grows && snake->tail) {
+        snake_node_t* old_tail = snake->tail;
+        snake_node_t* current = snake->head;
+        
+        // 새로운 꼬리 찾기
+        while (current->next != snake->tail) {
+            current = current->next;
+        }
+        
+        snake->tail = current;
+        snake->tail->next = NULL;
+        
+        // 기존 꼬리를 맵에서 제거
+        game->map[old_tail->pos.y][old_tail->pos.x] = CELL_EMPTY;
+        free(old_tail);
+        snake->length--;
+    }
+    
+    snake->score++; // 이동 점수
+    if (intent->grows) {
+        snake->score += 100;  // 사과 점수
+    }
+}
+
 /**
  * @brief 게임 상태를 업데이트합니다
  * 
+ * 모든 뱀이 이전 틱 상태를 기준으로 동시에 움직입니다. 먼저 뱀마다 이동
+ * 의도를 계산하고, 의도끼리의 충돌을 정리한 다음, 한꺼번에 적용합니다.
+ * 그래서 플레이어 배열 순서가 결과에 영향을 주지 않습니다.
+ * 
  * @param game 게임 상태 포인터
  * @return 게임이 계속되면 true, 종료되면 false
  */
@@ -416,100 +1033,55 @@ bool game_update(game_state_t* game) {
     
     platform_lock_mutex(game->game_mutex);
     
-    int alive_count = 0;
-    int last_alive = -1;
+    // 입력 큐에 쌓인 방향 전환을 플레이어당 최대 하나씩 적용
+    apply_queued_turns(game);
     
-    // 각 뱀 업데이트
+    // 1단계: 이전 상태만 읽어 각 뱀의 이동 의도 계산 (뱀끼리 독립적)
+    move_intent_t intents[MAX_PLAYERS];
     for (int i = 0; i < game->num_players; i++) {
-        snake_t* snake = &game->players[i];
-        if (!snake->alive) continue;
-        
-        alive_count++;
-        last_alive = i;
+        compute_move_intent(game, i, &intents[i]);
+    }
+    
+    // 2단계: 머리끼리의 충돌을 순서와 무관하게 정리한 뒤 적용
+    resolve_move_conflicts(intents, game->num_players);
+    
+    int apples_eaten = 0;
+    for (int i = 0; i < game->num_players; i++) {
+        if (!intents[i].active) continue;
         
-        // 방향 업데이트 (역방향으로는 이동 불가)
-        if (!is_opposite_direction(snake->direction, snake->next_direction)) {
-            snake->direction = snake->next_direction;
+        // 실제로 적용되는 방향 전환만 리플레이에 기록
+        if (game->recorder && intents[i].direction != game->players[i].direction) {
+            replay_record_turn(game->recorder, game->tick_count, i, intents[i].direction);
         }
-        
-        // 마지막 위치 저장 (부드러운 모션용)
-        snake->last_pos = snake->head->pos;
-        snake->move_progress = 0.0f; // 새로운 움직임 시작
-        
-        // 다음 머리 위치 계산
-        position_t next_pos = get_next_position(snake->head->pos, snake->direction);
-        
-        // 벽 충돌 검사
-        if (!is_valid_position(next_pos)) {
-            snake->alive = false;
-            continue;
+        apply_move_intent(game, &game->players[i], &intents[i]);
+        if (intents[i].grows && !intents[i].dies) {
+            apples_eaten++;
         }
-        
-        // 다음 위치의 내용물 확인
-        char cell = game->map[next_pos.y][next_pos.x];
-        bool grow = false;
-        
-        if (cell == CELL_APPLE) {
-            grow = true;
-            snake->score += 100;  // 사과 점수
-            game->apples_eaten++;
-            game_generate_apple(game);
-
-            // 사과를 먹었을 때 80% 확률로 장애물 생성
-            if (platform_random(1, 100) <= 80) {
-                game_generate_obstacle(game);
-            }
+    }
+    
+    // 먹힌 사과를 모든 이동이 끝난 맵에 다시 배치
+    for (int i = 0; i < apples_eaten; i++) {
+        game->apples_eaten++;
+        game_generate_apple(game);
 
-            // 게임 속도 점진적 증가
-            if (game->game_speed > 80) {
-                game->game_speed -= 1;
-            }
-        } else if (cell == CELL_SNAKE_HEAD || cell == CELL_SNAKE_BODY) {
-            snake->alive = false;
-            continue;
-        } else if (cell == CELL_OBSTACLE) {
-            snake->alive = false;
-            continue;
+        // 사과를 먹었을 때 80% 확률로 장애물 생성
+        if (game_random(game, 1, 100) <= 80) {
+            game_generate_obstacle(game);
         }
-        
-        // 뱀 이동
-        snake_node_t* new_head = create_snake_node(next_pos);
-        if (!new_head) {
-            snake->alive = false;
-            continue;
+
+        // 게임 속도 점진적 증가
+        if (game->game_speed > 80) {
+            game->game_speed -= 1;
         }
-        
-        // 맵 업데이트 - 기존 머리를 몸통으로 변경
-        game->map[snake->head->pos.y][snake->head->pos.x] = CELL_SNAKE_BODY;
-        
-        // 새 머리 추가
-        new_head->next = snake->head;
-        snake->head = new_head;
-        snake->length++;
-        
-        // 새 머리를 맵에 표시
-        game->map[next_pos.y][next_pos.x] = CELL_SNAKE_HEAD;
-        
-        // 성장하지 않을 때 꼬리 제거
-        if (!grow && snake->tail) {
-            snake_node_t* old_tail = snake->tail;
-            snake_node_t* current = snake->head;
-            
-            // 새로운 꼬리 찾기
-            while (current->next != snake->tail) {
-                current = current->next;
-            }
-            
-            snake->tail = current;
-            snake->tail->next = NULL;
-            
-            // 기존 꼬리를 맵에서 제거
-            game->map[old_tail->pos.y][old_tail->pos.x] = CELL_EMPTY;
-            free(old_tail);
-            snake->length--;
+    }
+    
+    int alive_count = 0;
+    int last_alive = -1;
+    for (int i = 0; i < game->num_players; i++) {
+        if (game->players[i].alive) {
+            alive_count++;
+            last_alive = i;
         }
-        
-        snake->score++; // 이동 점수
     }
     
     // 게임 종료 조건 확인
@@ -529,44 +1101,106 @@ bool game_update(game_state_t* game) {
             }
         }
     }
+    if (game->game_over) {
+        game->game_end_time = game_clock_now_ms(&game->clock);
+    }
+    
+    game->tick_count++;
+    replay_record_tick_end(game->recorder, game);
+    
+    // 이번 틱의 결과를 렌더러에 발행
+    game->last_tick_time = game_clock_now_ms(&game->clock);
+    game_publish_snapshot(game);
     
     platform_unlock_mutex(game->game_mutex);
     return !game->game_over;
 }
 
+// 부드러운 모션 렌더링용 반 칸 격자 - 가로는 터미널 열, 세로는 반 줄 단위
+#define SMOOTH_COLS (GAME_WIDTH * 2)
+
+typedef struct {
+    uint8_t mask[GAME_HEIGHT][SMOOTH_COLS];    // 비트 0: 윗 반칸, 비트 1: 아랫 반칸
+    color_t color[GAME_HEIGHT][SMOOTH_COLS];   // 칸의 전경색
+} smooth_layer_t;
+
+// 마스크 값에 대응하는 반 블록 문자
+static const char* const half_block_glyphs[4] = {" ", "▀", "▄", "█"};
+
 /**
- * @brief 게임 화면을 렌더링합니다
+ * @brief 부동소수점 위치의 뱀 마디 하나를 반 칸 격자에 찍습니다
  * 
- * @param game 게임 상태 포인터
+ * 맵 한 칸은 격자에서 2x2 반 칸을 차지하므로, 반 칸 단위로 반올림한 위치에 찍습니다.
  */
-void game_render(game_state_t* game) {
-    if (!game) return;
-    
-    static bool first_render = true;
-    static uint64_t last_game_start = 0;
+static void smooth_layer_plot(smooth_layer_t* layer, float x, float y, color_t color) {
+    int sub_x = (int)floorf(x * 2.0f + 0.5f);
+    int sub_y = (int)floorf(y * 2.0f + 0.5f);
     
-    // 새 게임용 first_render 플래그 리셋
-    if (game->game_start_time != last_game_start) {
-        first_render = true;
-        last_game_start = game->game_start_time;
+    for (int dy = 0; dy < 2; dy++) {
+        for (int dx = 0; dx < 2; dx++) {
+            int px = sub_x + dx;
+            int py = sub_y + dy;
+            if (px < 0 || px >= SMOOTH_COLS || py < 0 || py >= GAME_HEIGHT * 2) continue;
+            
+            layer->mask[py / 2][px] |= (py & 1) ? 2 : 1;
+            layer->color[py / 2][px] = color;
+        }
     }
+}
+
+/**
+ * @brief 살아있는 뱀들을 보간 위치로 반 칸 격자에 그립니다
+ */
+static void smooth_layer_build(smooth_layer_t* layer, const game_snapshot_t* game) {
+    memset(layer->mask, 0, sizeof(layer->mask));
     
-    // 깜박임 방지를 위해 첫 렌더링에만 화면 클리어
-    if (first_render) {
-        platform_clear_screen();
-        first_render = false;
+    // 몸통을 먼저 찍고 머리는 마지막에 찍어 겹칠 때 머리 색이 보이도록 함
+    for (int i = 0; i < game->num_players; i++) {
+        const snake_snapshot_t* snake = &game->players[i];
+        if (!snake->alive) continue;
         
-        // 테두리 그리기 (한 번만)
-        platform_set_color(COLOR_WHITE);
-        for (int x = 0; x < GAME_WIDTH + 2; x++) {
-            platform_print_at(x * 2, 0, "██");
-            platform_print_at(x * 2, GAME_HEIGHT + 1, "██");
-        }
-        for (int y = 1; y <= GAME_HEIGHT; y++) {
-            platform_print_at(0, y, "██");
-            platform_print_at((GAME_WIDTH + 1) * 2, y, "██");
+        for (int k = 1; k < snake->length; k++) {
+            smooth_layer_plot(layer, snake->smooth_x[k], snake->smooth_y[k], snake->color);
         }
     }
+    for (int i = 0; i < game->num_players; i++) {
+        const snake_snapshot_t* snake = &game->players[i];
+        if (!snake->alive) continue;
+        
+        smooth_layer_plot(layer, snake->smooth_x[0], snake->smooth_y[0], snake->head_color);
+    }
+}
+
+/**
+ * @brief 게임 화면을 렌더링합니다
+ * 
+ * 시뮬레이션이 발행한 스냅샷만 읽으므로 game_mutex 없이 호출합니다.
+ * 
+ * @param game 렌더러가 가져온 게임 스냅샷
+ */
+void game_render(const game_snapshot_t* game) {
+    if (!game) return;
+    
+    // 매 프레임 가상 화면에 전체를 다시 그림 - 실제 출력은 합성기가 바뀐 셀만 내보냄
+    platform_clear_screen();
+
+    // 테두리 그리기
+    platform_set_color(COLOR_WHITE);
+    for (int x = 0; x < GAME_WIDTH + 2; x++) {
+        platform_print_at(x * 2, 0, "██");
+        platform_print_at(x * 2, GAME_HEIGHT + 1, "██");
+    }
+    for (int y = 1; y <= GAME_HEIGHT; y++) {
+        platform_print_at(0, y, "██");
+        platform_print_at((GAME_WIDTH + 1) * 2, y, "██");
+    }
+    
+    // 부드러운 모션: 뱀은 맵 대신 보간 위치로 그림
+    static smooth_layer_t smooth_layer;
+    bool smooth = game->smooth_motion_enabled;
+    if (smooth) {
+        smooth_layer_build(&smooth_layer, game);
+    }
     
     // 게임 필드 그리기
     for (int y = 0; y < GAME_HEIGHT; y++) {
@@ -574,6 +1208,20 @@ void game_render(game_state_t* game) {
             char cell = game->map[y][x];
             position_t screen_pos = {(x + 1) * 2, y + 1};
             
+            // 뱀 마디가 걸친 칸은 반 블록으로 그림
+            if (smooth && (smooth_layer.mask[y][x * 2] | smooth_layer.mask[y][x * 2 + 1])) {
+                for (int half = 0; half < 2; half++) {
+                    uint8_t mask = smooth_layer.mask[y][x * 2 + half];
+                    if (mask) {
+                        platform_set_color(smooth_layer.color[y][x * 2 + half]);
+                    } else {
+                        platform_set_color(COLOR_BLACK);
+                    }
+                    platform_print_at(screen_pos.x + half, screen_pos.y, half_block_glyphs[mask]);
+                }
+                continue;
+            }
+            
             switch (cell) {
                 case CELL_EMPTY:
                     platform_set_color(COLOR_BLACK);
@@ -592,29 +1240,23 @@ void game_render(game_state_t* game) {
                     
                 case CELL_SNAKE_HEAD:
                 case CELL_SNAKE_BODY:
-                    // 어느 뱀에 속하는지 찾기
-                    for (int i = 0; i < game->num_players; i++) {
-                        snake_t* snake = &game->players[i];
-                        if (!snake->alive) continue;
-                        
-                        snake_node_t* current = snake->head;
-                        bool found = false;
-                        
-                        while (current && !found) {
-                            if (current->pos.x == x && current->pos.y == y) {
-                                if (current == snake->head) {
-                                    platform_set_color(snake->head_color);
-                                    platform_print_at(screen_pos.x, screen_pos.y, "[]");
-                                } else {
-                                    platform_set_color(snake->color);
-                                    platform_print_at(screen_pos.x, screen_pos.y, "##");
-                                }
-                                found = true;
-                            }
-                            current = current->next;
+                    // 부드러운 모션에서는 마디가 이미 이 칸을 벗어남
+                    if (smooth) {
+                        platform_set_color(COLOR_BLACK);
+                        platform_print_at(screen_pos.x, screen_pos.y, "  ");
+                        break;
+                    }
+                    
+                    // 칸 소유자 격자로 어느 뱀에 속하는지 확인 (죽은 뱀은 그리지 않음)
+                    if (game->owner[y][x] >= 0) {
+                        const snake_snapshot_t* snake = &game->players[game->owner[y][x]];
+                        if (cell == CELL_SNAKE_HEAD) {
+                            platform_set_color(snake->head_color);
+                            platform_print_at(screen_pos.x, screen_pos.y, "[]");
+                        } else {
+                            platform_set_color(snake->color);
+                            platform_print_at(screen_pos.x, screen_pos.y, "##");
                         }
-                        
-                        if (found) break;
                     }
                     break;
             }
@@ -646,7 +1288,7 @@ void game_render(game_state_t* game) {
     
     if (game->mode == GAME_MODE_SINGLE) {
         // 싱글 플레이어 모드 정보 표시
-        snake_t* player_snake = &game->players[0];
+        const snake_snapshot_t* player_snake = &game->players[0];
         
         // 점수 표시
         platform_set_color(COLOR_BRIGHT_GREEN);
@@ -668,7 +1310,7 @@ void game_render(game_state_t* game) {
         platform_print_at(ui_x, info_start_y, "플레이어 정보:");
         
         for (int i = 0; i < game->num_players; i++) {
-            snake_t* snake = &game->players[i];
+            const snake_snapshot_t* snake = &game->players[i];
             char status[64];
             
             platform_set_color(snake->color);
@@ -692,13 +1334,29 @@ void game_render(game_state_t* game) {
     
     // 플레이 시간 표시
     platform_set_color(COLOR_BRIGHT_MAGENTA);
-    uint64_t play_time = game_get_play_time(game) / 1000;
+    uint64_t play_time = game->play_time / 1000;
     int minutes = (int)(play_time / 60);
     int seconds = (int)(play_time % 60);
     char time_text[32];
     snprintf(time_text, sizeof(time_text), "시간: %d:%02d", minutes, seconds);
     platform_print_at(ui_x, info_start_y + 8, time_text);
     
+    // 틱 스케줄링 정확도 (예정 시각 대비 지연)
+    const tick_stats_t* stats = &game->tick_stats;
+    if (stats->ticks > 0) {
+        platform_set_color(COLOR_BRIGHT_BLACK);
+        char jitter_text[64];
+        snprintf(jitter_text, sizeof(jitter_text), "틱 지연: 평균 %lluus 최대 %lluus",
+                (unsigned long long)(stats->total_jitter_us / stats->ticks),
+                (unsigned long long)stats->max_jitter_us);
+        platform_print_at(ui_x, 25, jitter_text);
+        
+        char miss_text[64];
+        snprintf(miss_text, sizeof(miss_text), "마감 초과: %u회 (%.1f%%)", (unsigned)stats->deadline_misses,
+                100.0 * stats->deadline_misses / stats->ticks);
+        platform_print_at(ui_x, 26, miss_text);
+    }
+    
     // 조작 방법 안내
     platform_set_color(COLOR_WHITE);
     platform_print_at(ui_x, 15, "조작 방법:");
@@ -727,7 +1385,7 @@ void game_render(game_state_t* game) {
     
     platform_reset_color();
     
-    // Windows에서 더블 버퍼링된 화면을 실제 콘솔에 출력
+    // 가상 화면의 변경분만 실제 화면에 출력
     platform_present_buffer();
 }
 
@@ -757,8 +1415,7 @@ void game_handle_input(game_state_t* game, int player_id, game_key_t key) {
         return;
     }
     
-    snake_t* snake = &game->players[0];
-    direction_t new_dir = snake->next_direction;
+    direction_t new_dir;
     
     // 사용자 입력 처리: 화살표 키 또는 WASD
     switch (key) {
@@ -782,12 +1439,13 @@ void game_handle_input(game_state_t* game, int player_id, game_key_t key) {
             return; // 다른 키는 무시
     }
     
-    // 현재 방향과 반대가 아닐 때만 업데이트
-    if (!is_opposite_direction(snake->direction, new_dir)) {
-        platform_lock_mutex(game->game_mutex);
-        snake->next_direction = new_dir;
-        platform_unlock_mutex(game->game_mutex);
-    }
+    // 방향 전환은 큐에 넣고 다음 틱의 game_update가 순서대로 적용 (잠금 없음)
+    input_event_t event = {
+        game_clock_now_ms(&game->clock),
+        (uint8_t)player_id,
+        (uint8_t)new_dir
+    };
+    input_queue_push(&game->input_queue, &event);
 }
 
 /**
@@ -811,7 +1469,7 @@ void game_generate_apple(game_state_t* game) {
     }
     
     if (empty_count > 0) {
-        int index = platform_random(0, empty_count - 1);
+        int index = game_random(game, 0, empty_count - 1);
         position_t pos = empty_positions[index];
         game->map[pos.y][pos.x] = CELL_APPLE;
         game->apples_count++;
@@ -839,7 +1497,7 @@ void game_generate_obstacle(game_state_t* game) {
     }
     
     if (empty_count > 0) {
-        int index = platform_random(0, empty_count - 1);
+        int index = game_random(game, 0, empty_count - 1);
         position_t pos = empty_positions[index];
         game->map[pos.y][pos.x] = CELL_OBSTACLE;
         game->obstacles_count++;
@@ -3,12 +3,16 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "../platform/platform.h"
+#include "input_queue.h"
+#include "game_clock.h"
 
 // 게임 영역 크기 상수
 #define GAME_WIDTH 40              // 게임 가로 크기
 #define GAME_HEIGHT 40             // 게임 세로 크기
 #define MAX_PLAYERS 2              // 최대 플레이어 수 (사용자 + AI)
+#define MAX_SNAKE_LENGTH (GAME_WIDTH * GAME_HEIGHT)  // 뱀의 최대 길이
 
 /**
  * @brief 뱀의 이동 방향을 나타내는 열거형
@@ -68,7 +72,6 @@ typedef struct {
  */
 typedef struct snake_node {
     position_t pos;                // 논리적 위치 정보
-    smooth_position_t smooth_pos;  // 부드러운 렌더링 위치
     struct snake_node* next;       // 다음 노드 포인터
 } snake_node_t;
 
@@ -89,8 +92,8 @@ typedef struct {
     color_t head_color;            // 뱀 머리 색상
     
     // 부드러운 모션 관련
-    float move_progress;           // 이동 진행도 (0.0 ~ 1.0)
     position_t last_pos;           // 마지막 위치 (보간용)
+    position_t last_tail_pos;      // 직전 틱의 꼬리 위치 (꼬리 보간용)
 } snake_t;
 
 /**
@@ -107,6 +110,68 @@ typedef enum {
 // 오디오 시스템 전방 선언
 struct audio_system;
 
+// 리플레이 기록기 전방 선언 (replay.h)
+struct replay_recorder;
+
+/**
+ * @brief 고정 간격 틱 스케줄링 통계 (마이크로초)
+ */
+typedef struct {
+    uint64_t ticks;                // 측정한 틱 수
+    uint64_t last_jitter_us;       // 마지막 틱이 예정 시각보다 늦은 정도
+    uint64_t max_jitter_us;        // 가장 크게 늦은 정도
+    uint64_t total_jitter_us;      // 누적 지연 (평균 계산용)
+    uint32_t deadline_misses;      // 허용 오차를 넘겨 실행된 틱 수
+} tick_stats_t;
+
+// 틱이 이 시간보다 늦게 실행되면 마감 시간을 놓친 것으로 봄
+#define TICK_DEADLINE_SLACK_US 2000
+
+// 스냅샷 삼중 버퍼 관련 상수
+#define GAME_SNAPSHOT_COUNT 3      // 시뮬레이션 쓰기 / 발행 대기 / 렌더러 읽기
+#define SNAPSHOT_INDEX_MASK 0x3    // 버퍼 인덱스 비트
+#define SNAPSHOT_FRESH 0x4         // 발행 후 아직 렌더러가 가져가지 않은 버퍼 표시
+
+/**
+ * @brief 렌더러에 전달되는 뱀 한 마리의 스냅샷
+ */
+typedef struct {
+    bool alive;                    // 생존 여부
+    int length;                    // 뱀의 길이
+    int score;                     // 점수
+    color_t color;                 // 뱀 몸통 색상
+    color_t head_color;            // 뱀 머리 색상
+    
+    // 부드러운 모션용 SoA 배열 (머리 → 꼬리 순)
+    float trail_x[MAX_SNAKE_LENGTH + 1];   // 마디 위치 + 직전 꼬리 위치
+    float trail_y[MAX_SNAKE_LENGTH + 1];
+    float smooth_x[MAX_SNAKE_LENGTH];      // 보간된 렌더링 위치 (렌더러가 채움)
+    float smooth_y[MAX_SNAKE_LENGTH];
+} snake_snapshot_t;
+
+/**
+ * @brief 시뮬레이션이 한 틱마다 발행하는 게임 화면 스냅샷
+ * 
+ * 발행된 뒤에는 시뮬레이션이 다시 쓰지 않으므로, 렌더러는 잠금 없이
+ * 읽을 수 있습니다 (보간 결과인 smooth_x/smooth_y만 렌더러가 씀).
+ */
+typedef struct {
+    char map[GAME_HEIGHT][GAME_WIDTH];      // 게임 맵
+    int8_t owner[GAME_HEIGHT][GAME_WIDTH];  // 뱀 칸을 차지한 플레이어 (-1이면 없음)
+    snake_snapshot_t players[MAX_PLAYERS];  // 플레이어별 스냅샷
+    int num_players;                        // 현재 플레이어 수
+    game_mode_t mode;                       // 게임 모드
+    game_state_enum_t state;                // 게임 상태
+    bool game_over;                         // 게임 종료 여부
+    int winner_id;                          // 승자 ID (-1이면 승자 없음)
+    int game_speed;                         // 게임 속도 (밀리초)
+    int obstacles_count;                    // 장애물 개수
+    bool smooth_motion_enabled;             // 부드러운 모션 활성화 여부
+    uint64_t tick_time;                     // 이 스냅샷을 만든 틱의 시각 (보간 기준)
+    uint64_t play_time;                     // 실제 플레이 시간 (일시정지 제외)
+    tick_stats_t tick_stats;                // 틱 스케줄링 통계
+} game_snapshot_t;
+
 /**
  * @brief 게임의 전체 상태를 나타내는 구조체
  */
@@ -120,25 +185,49 @@ typedef struct {
     int obstacles_count;                    // 장애물 개수
     bool game_over;                         // 게임 종료 여부
     int winner_id;                          // 승자 ID (-1이면 승자 없음)
+    game_clock_t clock;                     // 게임 시간 소스 (실시간/가상/배속)
     uint64_t game_start_time;               // 게임 시작 시간
+    uint64_t game_end_time;                 // 게임 종료 시간 (종료 후 플레이 시간 고정용)
     uint64_t pause_start_time;              // 일시정지 시작 시간
     uint64_t total_pause_time;              // 총 일시정지 시간
+    uint64_t play_time_offset;              // 이어하기 전까지의 플레이 시간 (save.h)
     int game_speed;                         // 게임 속도 (밀리초)
     bool smooth_motion_enabled;             // 부드러운 모션 활성화 여부
     float motion_interpolation;             // 모션 보간 계수 (0.0 ~ 1.0)
     mutex_handle_t game_mutex;              // 게임 상태 동기화용 뮤텍스
+    input_queue_t input_queue;              // 입력 루프 → 시뮬레이션 방향 입력 큐
+    uint64_t last_tick_time;                // 마지막으로 뱀이 움직인 시각
+    
+    // 재현 가능한 시뮬레이션 (같은 시드와 방향 전환이면 같은 결과)
+    uint32_t seed;                          // 이 게임의 난수 시드
+    uint32_t rng_state;                     // 게임 전용 난수 상태 (xorshift32)
+    uint32_t tick_count;                    // 실행된 틱 수 (일시정지 제외)
+    struct replay_recorder* recorder;       // 방향 전환 기록기 (NULL이면 기록 안 함)
+
+    // 렌더러와 공유하는 스냅샷 삼중 버퍼 (발행 쪽은 game_mutex로 직렬화)
+    // game_attach_renderer 전에는 NULL이며, 그동안은 발행하지 않음 (서버/리플레이 분석)
+    game_snapshot_t* snapshots;
+    int snapshot_back;                      // 시뮬레이션이 다음에 채울 버퍼
+    volatile int32_t snapshot_ready;        // 최근 발행된 버퍼 인덱스 | SNAPSHOT_FRESH
+    int snapshot_front;                     // 렌더러가 읽고 있는 버퍼
 
     // 통계 정보
     int apples_eaten;                       // 먹은 사과 수
     uint64_t actual_play_time;              // 실제 플레이 시간 (일시정지 제외)
+    tick_stats_t tick_stats;                // 틱 스케줄링 통계 (시뮬레이션 루프가 기록)
 } game_state_t;
 
 // 함수 선언
 bool game_init(game_state_t* game, game_mode_t mode);
+bool game_init_with_clock(game_state_t* game, game_mode_t mode, const game_clock_t* clock);
+bool game_init_with_seed(game_state_t* game, game_mode_t mode, const game_clock_t* clock, uint32_t seed);
 void game_cleanup(game_state_t* game);
 bool game_update(game_state_t* game);
-void game_update_smooth_motion(game_state_t* game, float delta_time);
-void game_render(game_state_t* game);
+bool game_attach_renderer(game_state_t* game);
+void game_publish_snapshot(game_state_t* game);
+game_snapshot_t* game_acquire_snapshot(game_state_t* game);
+void game_update_smooth_motion(game_snapshot_t* snapshot, uint64_t current_time);
+void game_render(const game_snapshot_t* snapshot);
 void game_handle_input(game_state_t* game, int player_id, game_key_t key);
 void game_toggle_pause(game_state_t* game);
 bool game_is_paused(const game_state_t* game);
@@ -149,6 +238,16 @@ void game_generate_obstacle(game_state_t* game);
 // 통계 관련 함수들
 uint64_t game_get_play_time(game_state_t* game);
 void game_update_statistics(game_state_t* game);
+void game_record_tick_jitter(game_state_t* game, uint64_t jitter_us);
+uint64_t game_state_hash(const game_state_t* game);  // 리플레이 검증용 시뮬레이션 상태 해시
+
+// 시뮬레이션 상태 직렬화 (리플레이 키프레임용 - 시각, 통계, 스냅샷은 제외)
+#define GAME_STATE_HEADER_SIZE 27
+#define GAME_STATE_SNAKE_HEADER_SIZE 9
+#define GAME_STATE_MAX_SERIALIZED_SIZE (GAME_STATE_HEADER_SIZE + GAME_WIDTH * GAME_HEIGHT + \
+        MAX_PLAYERS * (GAME_STATE_SNAKE_HEADER_SIZE + MAX_SNAKE_LENGTH * 2))
+size_t game_serialize_state(const game_state_t* game, uint8_t* out, size_t capacity);
+bool game_deserialize_state(game_state_t* game, const uint8_t* data, size_t size);
 
 // AI를 위한 헬퍼 함수들
 bool is_valid_position(position_t pos);
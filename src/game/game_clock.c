@@ -0,0 +1,116 @@
+#include "game_clock.h"
+#include "../platform/platform.h"
+
+/**
+ * @brief 시계를 초기화합니다
+ * 
+ * REAL은 플랫폼 시각, VIRTUAL은 0에서 시작합니다. SCALED로 초기화하면
+ * 배율 1.0의 현재 시각에서 시작하며, 배율은 game_clock_set_scale로 바꿉니다.
+ * 
+ * @param clock 시계 포인터
+ * @param mode 동작 방식
+ */
+void game_clock_init(game_clock_t* clock, game_clock_mode_t mode) {
+    if (!clock) return;
+    
+    clock->mode = mode;
+    clock->virtual_time_us = 0;
+    clock->origin_real_us = platform_get_time_us();
+    clock->origin_game_us = clock->origin_real_us;
+    clock->scale = 1.0;
+}
+
+/**
+ * @brief 시계를 배속 모드로 바꾸거나 배율을 변경합니다
+ * 
+ * 현재 게임 시각을 기준점으로 다시 잡으므로 배율을 바꿔도 시간이 튀지 않습니다.
+ * 
+ * @param clock 시계 포인터
+ * @param scale 배율 (0보다 커야 함)
+ */
+void game_clock_set_scale(game_clock_t* clock, double scale) {
+    if (!clock || scale <= 0.0) return;
+    
+    uint64_t now_game = game_clock_now_us(clock);
+    clock->origin_real_us = platform_get_time_us();
+    clock->origin_game_us = now_game;
+    clock->scale = scale;
+    clock->mode = GAME_CLOCK_SCALED;
+}
+
+/**
+ * @brief 현재 게임 시각을 반환합니다 (마이크로초)
+ * 
+ * @param clock 시계 포인터
+ * @return 게임 시각
+ */
+uint64_t game_clock_now_us(const game_clock_t* clock) {
+    if (!clock) return platform_get_time_us();
+    
+    switch (clock->mode) {
+        case GAME_CLOCK_VIRTUAL:
+            return clock->virtual_time_us;
+            
+        case GAME_CLOCK_SCALED: {
+            uint64_t elapsed = platform_get_time_us() - clock->origin_real_us;
+            return clock->origin_game_us + (uint64_t)((double)elapsed * clock->scale);
+        }
+        
+        case GAME_CLOCK_REAL:
+        default:
+            return platform_get_time_us();
+    }
+}
+
+/**
+ * @brief 현재 게임 시각을 반환합니다 (밀리초)
+ * 
+ * @param clock 시계 포인터
+ * @return 게임 시각
+ */
+uint64_t game_clock_now_ms(const game_clock_t* clock) {
+    return game_clock_now_us(clock) / 1000;
+}
+
+/**
+ * @brief 가상 시계를 진행시킵니다 (VIRTUAL 모드에서만 효과 있음)
+ * 
+ * @param clock 시계 포인터
+ * @param delta_us 진행할 시간 (마이크로초)
+ */
+void game_clock_advance_us(game_clock_t* clock, uint64_t delta_us) {
+    if (!clock || clock->mode != GAME_CLOCK_VIRTUAL) return;
+    
+    clock->virtual_time_us += delta_us;
+}
+
+/**
+ * @brief 게임 시각 기준의 절대 시각까지 대기합니다
+ * 
+ * REAL/SCALED는 해당 게임 시각에 대응하는 플랫폼 시각까지 잠들고,
+ * VIRTUAL은 잠들지 않고 시계를 그 시각으로 바로 옮깁니다.
+ * 
+ * @param clock 시계 포인터
+ * @param deadline_us 게임 시각 기준 목표 시각
+ * @param max_real_wait_us 실제로 잠드는 최대 시간 (종료 요청 확인용, VIRTUAL에는 무관)
+ */
+void game_clock_sleep_until_us(game_clock_t* clock, uint64_t deadline_us, uint64_t max_real_wait_us) {
+    if (!clock) return;
+    
+    if (clock->mode == GAME_CLOCK_VIRTUAL) {
+        if (deadline_us > clock->virtual_time_us) {
+            clock->virtual_time_us = deadline_us;
+        }
+        return;
+    }
+    
+    // 게임 시각을 플랫폼 시각으로 변환
+    uint64_t real_deadline = deadline_us;
+    if (clock->mode == GAME_CLOCK_SCALED) {
+        uint64_t game_offset = deadline_us > clock->origin_game_us ? deadline_us - clock->origin_game_us : 0;
+        real_deadline = clock->origin_real_us + (uint64_t)((double)game_offset / clock->scale);
+    }
+    
+    uint64_t wake_limit = platform_get_time_us() + max_real_wait_us;
+    platform_sleep_until_us(real_deadline < wake_limit ? real_deadline : wake_limit);
+}
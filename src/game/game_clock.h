@@ -0,0 +1,46 @@
+/**
+ * @file game_clock.h
+ * @brief 게임별 시간 소스 (실시간 / 가상 / 배속)
+ *
+ * 게임 로직은 platform_get_time_ms를 직접 부르지 않고 이 시계를 통해 시간을
+ * 읽습니다. 그래서 같은 게임 코드를 대화형 1배속, 관전용 배속, 그리고
+ * 실제 시간과 무관하게 최대 속도로 도는 일괄 시뮬레이션에서 모두 쓸 수 있습니다.
+ */
+
+#ifndef GAME_CLOCK_H
+#define GAME_CLOCK_H
+
+#include <stdint.h>
+
+/**
+ * @brief 시계 동작 방식
+ */
+typedef enum {
+    GAME_CLOCK_REAL,               // 플랫폼 단조 시계를 그대로 사용 (1배속)
+    GAME_CLOCK_VIRTUAL,            // 명시적으로 진행시킬 때만 흐름 (대기 없이 최대 속도)
+    GAME_CLOCK_SCALED              // 플랫폼 시계에 배율을 곱해 흐름 (예: 100배속)
+} game_clock_mode_t;
+
+/**
+ * @brief 게임 시계
+ * 
+ * 배율 변경과 가상 시간 진행은 시뮬레이션 스레드(또는 시뮬레이션이 멈춘
+ * 상태)에서만 해야 하며, 읽기는 어느 스레드에서나 할 수 있습니다.
+ */
+typedef struct {
+    game_clock_mode_t mode;        // 동작 방식
+    uint64_t virtual_time_us;      // VIRTUAL: 현재 가상 시각
+    uint64_t origin_real_us;       // SCALED: 기준점의 플랫폼 시각
+    uint64_t origin_game_us;       // SCALED: 기준점의 게임 시각
+    double scale;                  // SCALED: 배율 (1.0 = 실시간)
+} game_clock_t;
+
+// 함수 선언
+void game_clock_init(game_clock_t* clock, game_clock_mode_t mode);
+void game_clock_set_scale(game_clock_t* clock, double scale);
+uint64_t game_clock_now_us(const game_clock_t* clock);
+uint64_t game_clock_now_ms(const game_clock_t* clock);
+void game_clock_advance_us(game_clock_t* clock, uint64_t delta_us);
+void game_clock_sleep_until_us(game_clock_t* clock, uint64_t deadline_us, uint64_t max_real_wait_us);
+
+#endif // GAME_CLOCK_H
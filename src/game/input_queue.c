@@ -0,0 +1,74 @@
+#include "input_queue.h"
+#include "../platform/platform.h"
+
+/**
+ * @brief 입력 큐를 비웁니다
+ * 
+ * 생산자와 소비자가 모두 멈춰 있을 때만 호출해야 합니다.
+ * 
+ * @param queue 입력 큐 포인터
+ */
+void input_queue_init(input_queue_t* queue) {
+    if (!queue) return;
+    
+    platform_atomic_store(&queue->head, 0);
+    platform_atomic_store(&queue->tail, 0);
+}
+
+/**
+ * @brief 이벤트를 큐 끝에 추가합니다 (생산자 전용)
+ * 
+ * @param queue 입력 큐 포인터
+ * @param event 추가할 이벤트
+ * @return 추가했으면 true, 큐가 가득 찼으면 false
+ */
+bool input_queue_push(input_queue_t* queue, const input_event_t* event) {
+    if (!queue || !event) return false;
+    
+    int32_t tail = queue->tail;  // 생산자만 쓰는 값
+    int32_t next = (tail + 1) & INPUT_QUEUE_MASK;
+    
+    if (next == platform_atomic_load(&queue->head)) {
+        return false;
+    }
+    
+    // 슬롯을 채운 뒤 tail을 공개해야 소비자가 완성된 이벤트만 봄
+    queue->events[tail] = *event;
+    platform_atomic_store(&queue->tail, next);
+    return true;
+}
+
+/**
+ * @brief 맨 앞 이벤트를 꺼내지 않고 읽습니다 (소비자 전용)
+ * 
+ * @param queue 입력 큐 포인터
+ * @param event 읽은 이벤트를 받을 포인터
+ * @return 이벤트가 있으면 true
+ */
+bool input_queue_peek(input_queue_t* queue, input_event_t* event) {
+    if (!queue || !event) return false;
+    
+    int32_t head = queue->head;  // 소비자만 쓰는 값
+    if (head == platform_atomic_load(&queue->tail)) {
+        return false;
+    }
+    
+    *event = queue->events[head];
+    return true;
+}
+
+/**
+ * @brief 맨 앞 이벤트를 버립니다 (소비자 전용, peek 성공 후 호출)
+ * 
+ * @param queue 입력 큐 포인터
+ */
+void input_queue_pop(input_queue_t* queue) {
+    if (!queue) return;
+    
+    int32_t head = queue->head;
+    if (head == platform_atomic_load(&queue->tail)) {
+        return;
+    }
+    
+    platform_atomic_store(&queue->head, (head + 1) & INPUT_QUEUE_MASK);
+}
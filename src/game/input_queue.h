@@ -0,0 +1,43 @@
+/**
+ * @file input_queue.h
+ * @brief 입력 루프와 시뮬레이션 사이의 잠금 없는 입력 큐
+ *
+ * 단일 생산자(입력 루프)와 단일 소비자(게임 업데이트) 사이에서
+ * 시간 정보가 붙은 방향 입력 이벤트를 순서대로 전달하는 링 버퍼입니다.
+ */
+
+#ifndef INPUT_QUEUE_H
+#define INPUT_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 큐 용량 (2의 거듭제곱, 실제로 담을 수 있는 이벤트는 하나 적음)
+#define INPUT_QUEUE_CAPACITY 32
+#define INPUT_QUEUE_MASK (INPUT_QUEUE_CAPACITY - 1)
+
+/**
+ * @brief 방향 입력 이벤트
+ */
+typedef struct {
+    uint64_t timestamp;            // 입력 시각 (밀리초)
+    uint8_t player_id;             // 입력한 플레이어 ID
+    uint8_t direction;             // 요청한 방향 (direction_t)
+} input_event_t;
+
+/**
+ * @brief 단일 생산자/단일 소비자 링 버퍼
+ */
+typedef struct {
+    input_event_t events[INPUT_QUEUE_CAPACITY];   // 이벤트 저장 공간
+    volatile int32_t head;                        // 소비자가 다음에 읽을 위치
+    volatile int32_t tail;                        // 생산자가 다음에 쓸 위치
+} input_queue_t;
+
+// 함수 선언
+void input_queue_init(input_queue_t* queue);
+bool input_queue_push(input_queue_t* queue, const input_event_t* event);
+bool input_queue_peek(input_queue_t* queue, input_event_t* event);
+void input_queue_pop(input_queue_t* queue);
+
+#endif // INPUT_QUEUE_H
@@ -0,0 +1,48 @@
+#include "motion.h"
+
+// 사용할 SIMD 명령어 집합 선택
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define MOTION_SIMD_SSE2
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define MOTION_SIMD_NEON
+    #include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+    #define MOTION_SIMD_WASM
+    #include <wasm_simd128.h>
+#endif
+
+void motion_lerp_trail(const float* trail, float* out, int count, float t) {
+    // 진행도는 호출당 한 번만 고정 (내부 루프에는 분기 없음)
+    if (t < 0.0f) t = 0.0f;
+    if (t > 1.0f) t = 1.0f;
+    
+    int i = 0;
+    
+#if defined(MOTION_SIMD_SSE2)
+    __m128 vt = _mm_set1_ps(t);
+    for (; i + 4 <= count; i += 4) {
+        __m128 to = _mm_loadu_ps(trail + i);
+        __m128 from = _mm_loadu_ps(trail + i + 1);
+        _mm_storeu_ps(out + i, _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), vt)));
+    }
+#elif defined(MOTION_SIMD_NEON)
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t to = vld1q_f32(trail + i);
+        float32x4_t from = vld1q_f32(trail + i + 1);
+        vst1q_f32(out + i, vmlaq_n_f32(from, vsubq_f32(to, from), t));
+    }
+#elif defined(MOTION_SIMD_WASM)
+    v128_t vt = wasm_f32x4_splat(t);
+    for (; i + 4 <= count; i += 4) {
+        v128_t to = wasm_v128_load(trail + i);
+        v128_t from = wasm_v128_load(trail + i + 1);
+        wasm_v128_store(out + i, wasm_f32x4_add(from, wasm_f32x4_mul(wasm_f32x4_sub(to, from), vt)));
+    }
+#endif
+    
+    // 나머지 (또는 SIMD 미지원 시 전체) 스칼라 처리
+    for (; i < count; i++) {
+        out[i] = trail[i + 1] + (trail[i] - trail[i + 1]) * t;
+    }
+}
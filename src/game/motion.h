@@ -0,0 +1,29 @@
+/**
+ * @file motion.h
+ * @brief 부드러운 모션 보간 커널
+ *
+ * 뱀의 마디 위치를 구조체 배열(SoA) 형태의 연속된 float 배열로 받아
+ * 틱 사이의 보간 위치를 한 번에 계산합니다. SSE2/NEON/wasm-simd를 사용할 수
+ * 있으면 4개씩 벡터로 처리하고, 그렇지 않으면 스칼라 루프로 처리합니다.
+ */
+
+#ifndef MOTION_H
+#define MOTION_H
+
+/**
+ * @brief 뱀 한 축의 마디 보간 위치를 계산합니다
+ *
+ * trail은 머리부터 꼬리까지의 현재 위치 뒤에 직전 틱의 꼬리 위치가 하나 더
+ * 붙은 배열(count + 1개)입니다. 각 마디는 직전 틱에 자신을 뒤따르던 마디의
+ * 자리에서 현재 자리로 이동하므로 다음과 같이 계산합니다.
+ *
+ *     out[i] = trail[i + 1] + (trail[i] - trail[i + 1]) * t
+ *
+ * @param trail 목표 위치 배열 (count + 1개)
+ * @param out 보간 결과 배열 (count개)
+ * @param count 마디 수
+ * @param t 이동 진행도 (0.0 ~ 1.0 범위로 고정됨)
+ */
+void motion_lerp_trail(const float* trail, float* out, int count, float t);
+
+#endif // MOTION_H
@@ -0,0 +1,347 @@
+#include "netplay.h"
+#include <string.h>
+
+static void put_u32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+static void put_u16(uint8_t* out, uint32_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+}
+
+static uint32_t get_u16(const uint8_t* in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8;
+}
+
+static uint32_t get_u32(const uint8_t* in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+size_t netplay_encode_hello(uint8_t* out) {
+    out[0] = 2;
+    out[1] = NETPLAY_MSG_HELLO;
+    out[2] = NETPLAY_VERSION;
+    return 3;
+}
+
+size_t netplay_encode_turn(uint8_t* out, direction_t direction) {
+    out[0] = 2;
+    out[1] = NETPLAY_MSG_TURN;
+    out[2] = (uint8_t)direction;
+    return 3;
+}
+
+size_t netplay_encode_spectate(uint8_t* out, uint32_t match_id) {
+    out[0] = 5;
+    out[1] = NETPLAY_MSG_SPECTATE;
+    put_u32(out + 2, match_id);
+    return 6;
+}
+
+size_t netplay_encode_start(uint8_t* out, uint32_t seed, int player_id, int num_players) {
+    out[0] = 7;
+    out[1] = NETPLAY_MSG_START;
+    put_u32(out + 2, seed);
+    out[6] = (uint8_t)player_id;
+    out[7] = (uint8_t)num_players;
+    return 8;
+}
+
+size_t netplay_encode_tick(uint8_t* out, uint32_t tick, const uint8_t* events, int event_count) {
+    out[0] = (uint8_t)(5 + event_count);
+    out[1] = NETPLAY_MSG_TICK;
+    put_u32(out + 2, tick);
+    memcpy(out + 6, events, (size_t)event_count);
+    return 6 + (size_t)event_count;
+}
+
+size_t netplay_encode_end(uint8_t* out, const game_state_t* game, int winner_id) {
+    uint64_t hash = game_state_hash(game);
+    out[0] = 14;
+    out[1] = NETPLAY_MSG_END;
+    out[2] = (uint8_t)(int8_t)winner_id;
+    put_u32(out + 3, game->tick_count);
+    put_u32(out + 7, (uint32_t)hash);
+    put_u32(out + 11, (uint32_t)(hash >> 32));
+    return 15;
+}
+
+/**
+ * @brief 관전 프레임 머리를 쓰고 내용이 시작할 위치를 돌려줍니다 (길이는 finish_frame에서)
+ */
+static uint8_t* begin_frame(uint8_t* out, netplay_frame_type_t type, uint32_t tick) {
+    out[2] = (uint8_t)type;
+    put_u32(out + 3, tick);
+    return out + NETPLAY_FRAME_HEADER;
+}
+
+static size_t finish_frame(uint8_t* out, const uint8_t* end) {
+    size_t size = (size_t)(end - out);
+    put_u16(out, (uint32_t)(size - 2));
+    return size;
+}
+
+/**
+ * @brief 맵 전체를 담은 관전 프레임 (늦게 들어온 관전자의 시작점)
+ *
+ * 맵은 대부분 빈 칸이므로 같은 칸이 이어지는 구간을 (반복 수, 칸)으로 묶습니다.
+ *
+ * @param out 출력 버퍼 (NETPLAY_MAX_FRAME 바이트 이상)
+ * @param game 게임 상태
+ * @param match_id 대전 번호
+ * @return 쓴 바이트 수
+ */
+size_t netplay_encode_keyframe(uint8_t* out, const game_state_t* game, uint32_t match_id) {
+    const char* cells = &game->map[0][0];
+    uint8_t* p = begin_frame(out, NETPLAY_FRAME_KEY, game->tick_count);
+    put_u32(p, match_id);
+    p += 4;
+
+    int i = 0;
+    while (i < NETPLAY_MAP_CELLS) {
+        int run = 1;
+        while (run < 255 && i + run < NETPLAY_MAP_CELLS && cells[i + run] == cells[i]) {
+            run++;
+        }
+        *p++ = (uint8_t)run;
+        *p++ = (uint8_t)cells[i];
+        i += run;
+    }
+    return finish_frame(out, p);
+}
+
+/**
+ * @brief 직전 프레임 뒤 바뀐 칸만 담은 관전 프레임
+ *
+ * game_update가 한 틱에 바꾸는 칸은 뱀마다 머리, 목, 꼬리와 사과 정도이므로
+ * 바뀌지 않은 행은 통째로 건너뜁니다.
+ *
+ * @param out 출력 버퍼 (NETPLAY_MAX_FRAME 바이트 이상)
+ * @param game 게임 상태
+ * @param shadow 관전자들이 가진 맵 (GAME_HEIGHT x GAME_WIDTH, 이번 틱 맵으로 갱신됨)
+ * @return 쓴 바이트 수
+ */
+size_t netplay_encode_delta(uint8_t* out, const game_state_t* game, char* shadow) {
+    uint8_t* p = begin_frame(out, NETPLAY_FRAME_DELTA, game->tick_count);
+
+    for (int y = 0; y < GAME_HEIGHT; y++) {
+        char* row = shadow + y * GAME_WIDTH;
+        if (memcmp(row, game->map[y], GAME_WIDTH) == 0) continue;
+
+        for (int x = 0; x < GAME_WIDTH; x++) {
+            if (row[x] == game->map[y][x]) continue;
+            row[x] = game->map[y][x];
+            put_u16(p, (uint32_t)(y * GAME_WIDTH + x));
+            p[2] = (uint8_t)row[x];
+            p += 3;
+        }
+    }
+    return finish_frame(out, p);
+}
+
+size_t netplay_encode_frame_end(uint8_t* out, const game_state_t* game, int winner_id) {
+    uint8_t* p = begin_frame(out, NETPLAY_FRAME_END, game->tick_count);
+    p[0] = (uint8_t)(int8_t)winner_id;
+    put_u32(p + 1, netplay_map_hash(&game->map[0][0]));
+    return finish_frame(out, p + 5);
+}
+
+size_t netplay_decode(const uint8_t* data, size_t size, netplay_message_t* out) {
+    if (size < 1) return 0;
+    size_t length = data[0];
+    if (length < 1 || length + 1 > NETPLAY_MAX_MESSAGE) return NETPLAY_MALFORMED;
+    if (size < length + 1) return 0;
+
+    const uint8_t* body = data + 2;
+    size_t body_size = length - 1;
+    memset(out, 0, sizeof(*out));
+    out->type = (netplay_msg_type_t)data[1];
+
+    switch (out->type) {
+        case NETPLAY_MSG_HELLO:
+            if (body_size != 1) return NETPLAY_MALFORMED;
+            out->version = body[0];
+            break;
+
+        case NETPLAY_MSG_TURN:
+            if (body_size != 1 || body[0] > DIR_DOWN) return NETPLAY_MALFORMED;
+            out->direction = body[0];
+            break;
+
+        case NETPLAY_MSG_SPECTATE:
+            if (body_size != 4) return NETPLAY_MALFORMED;
+            out->match_id = get_u32(body);
+            break;
+
+        case NETPLAY_MSG_START:
+            if (body_size != 6 || body[5] > MAX_PLAYERS || body[4] >= body[5]) return NETPLAY_MALFORMED;
+            out->seed = get_u32(body);
+            out->player_id = body[4];
+            out->num_players = body[5];
+            break;
+
+        case NETPLAY_MSG_TICK:
+            if (body_size < 4 || body_size - 4 > MAX_PLAYERS) return NETPLAY_MALFORMED;
+            out->tick = get_u32(body);
+            out->event_count = (int)(body_size - 4);
+            memcpy(out->events, body + 4, (size_t)out->event_count);
+            break;
+
+        case NETPLAY_MSG_END:
+            if (body_size != 13) return NETPLAY_MALFORMED;
+            out->winner = (int8_t)body[0];
+            out->tick = get_u32(body + 1);
+            out->hash = (uint64_t)get_u32(body + 5) | (uint64_t)get_u32(body + 9) << 32;
+            break;
+
+        default:
+            return NETPLAY_MALFORMED;
+    }
+    return length + 1;
+}
+
+size_t netplay_decode_frame(const uint8_t* data, size_t size, netplay_frame_t* out) {
+    if (size < 2) return 0;
+    size_t length = get_u16(data);
+    if (length + 2 < NETPLAY_FRAME_HEADER || length + 2 > NETPLAY_MAX_FRAME) return NETPLAY_MALFORMED;
+    if (size < length + 2) return 0;
+
+    const uint8_t* body = data + NETPLAY_FRAME_HEADER;
+    size_t body_size = length + 2 - NETPLAY_FRAME_HEADER;
+    memset(out, 0, sizeof(*out));
+    out->type = (netplay_frame_type_t)data[2];
+    out->tick = get_u32(data + 3);
+
+    switch (out->type) {
+        case NETPLAY_FRAME_KEY:
+            if (body_size < 4 || (body_size - 4) % 2 != 0) return NETPLAY_MALFORMED;
+            out->match_id = get_u32(body);
+            out->cells = body + 4;
+            out->cells_size = body_size - 4;
+            break;
+
+        case NETPLAY_FRAME_DELTA:
+            if (body_size % 3 != 0) return NETPLAY_MALFORMED;
+            out->cells = body;
+            out->cells_size = body_size;
+            break;
+
+        case NETPLAY_FRAME_END:
+            if (body_size != 5) return NETPLAY_MALFORMED;
+            out->winner = (int8_t)body[0];
+            out->map_hash = get_u32(body + 1);
+            break;
+
+        default:
+            return NETPLAY_MALFORMED;
+    }
+    return length + 2;
+}
+
+static bool is_map_cell(uint8_t cell) {
+    return cell == CELL_EMPTY || cell == CELL_APPLE || cell == CELL_OBSTACLE ||
+           cell == CELL_SNAKE_HEAD || cell == CELL_SNAKE_BODY;
+}
+
+/**
+ * @brief 관전 프레임을 관전자의 맵에 적용합니다
+ *
+ * @param map 관전자 맵 (GAME_HEIGHT x GAME_WIDTH, 행 우선)
+ * @param frame netplay_decode_frame으로 해석한 프레임
+ * @return 프레임 내용이 올바르면 true (KEY는 맵을 정확히 채워야 함)
+ */
+bool netplay_apply_frame(char* map, const netplay_frame_t* frame) {
+    const uint8_t* cells = frame->cells;
+
+    switch (frame->type) {
+        case NETPLAY_FRAME_KEY: {
+            size_t filled = 0;
+            for (size_t i = 0; i < frame->cells_size; i += 2) {
+                size_t run = cells[i];
+                if (run == 0 || filled + run > (size_t)NETPLAY_MAP_CELLS || !is_map_cell(cells[i + 1])) return false;
+                memset(map + filled, cells[i + 1], run);
+                filled += run;
+            }
+            return filled == (size_t)NETPLAY_MAP_CELLS;
+        }
+
+        case NETPLAY_FRAME_DELTA:
+            for (size_t i = 0; i < frame->cells_size; i += 3) {
+                uint32_t index = get_u16(cells + i);
+                if (index >= (uint32_t)NETPLAY_MAP_CELLS || !is_map_cell(cells[i + 2])) return false;
+                map[index] = (char)cells[i + 2];
+            }
+            return true;
+
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief 맵 해시 (FNV-1a 32비트, 관전자가 받은 맵이 서버와 같은지 확인용)
+ */
+uint32_t netplay_map_hash(const char* map) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < NETPLAY_MAP_CELLS; i++) {
+        hash ^= (uint8_t)map[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief 원격 사용자 둘이 겨루는 대전을 시작 상태로 만듭니다
+ *
+ * 서버와 클라이언트가 같은 시드로 호출하면 같은 게임이 됩니다.
+ * 가상 시계를 쓰므로 벽시계 시간이 결과에 끼어들지 않습니다.
+ *
+ * @param game 게임 상태 (game_cleanup으로 정리)
+ * @param seed 게임 난수 시드
+ * @return 성공하면 true
+ */
+bool netplay_match_init(game_state_t* game, uint32_t seed) {
+    game_clock_t clock;
+    game_clock_init(&clock, GAME_CLOCK_VIRTUAL);
+
+    // 2인 대전 종료 규칙을 쓰되 두 번째 플레이어도 원격 사용자
+    if (!game_init_with_seed(game, GAME_MODE_VS_AI_MEDIUM, &clock, seed)) {
+        return false;
+    }
+    game->players[1].type = PLAYER_HUMAN;
+    return true;
+}
+
+/**
+ * @brief 이번 틱에 실제로 방향이 바뀌는 입력인지 확인합니다
+ *
+ * 같은 방향이나 반대 방향은 효과가 없으므로 보내지 않습니다
+ * (apply_queued_turns와 같은 규칙).
+ */
+bool netplay_is_turn(const game_state_t* game, int player_id, direction_t direction) {
+    if (player_id < 0 || player_id >= game->num_players) return false;
+
+    const snake_t* snake = &game->players[player_id];
+    return snake->alive && direction != snake->direction && !is_opposite_direction(snake->direction, direction);
+}
+
+/**
+ * @brief 한 틱의 방향 전환을 적용하고 시뮬레이션을 한 틱 진행합니다
+ *
+ * @param game 게임 상태
+ * @param events 방향 전환 (플레이어 << 2 | 방향)
+ * @param event_count 방향 전환 수
+ * @return 게임이 계속되면 true
+ */
+bool netplay_advance(game_state_t* game, const uint8_t* events, int event_count) {
+    for (int i = 0; i < event_count; i++) {
+        int player_id = events[i] >> 2;
+        if (player_id < game->num_players) {
+            game->players[player_id].next_direction = (direction_t)(events[i] & 0x3);
+        }
+    }
+
+    game_clock_advance_us(&game->clock, (uint64_t)game->game_speed * 1000);
+    return game_update(game);
+}
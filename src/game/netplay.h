@@ -0,0 +1,122 @@
+/**
+ * @file netplay.h
+ * @brief 네트워크 대전용 락스텝 프로토콜
+ *
+ * 서버와 클라이언트가 같은 시드로 같은 게임을 만들고, 틱마다 그 틱에
+ * 적용할 방향 전환만 주고받습니다. 시뮬레이션은 결정적이므로 모든 쪽이
+ * game_update를 같은 순서로 호출하면 같은 상태가 되며, 전체 상태는
+ * 보내지 않습니다. 끝날 때 서버가 상태 해시를 보내 어긋남을 확인합니다.
+ *
+ * 메시지 형식: 길이 u8 (종류 포함 바이트 수) | 종류 u8 | 내용 (리틀 엔디언)
+ *   클라이언트 → 서버
+ *     HELLO  버전 u8                          대전 대기열에 들어감
+ *     TURN   방향 u8                          다음 틱에 적용할 방향 전환
+ *     SPECTATE 대전 번호 u32                   관전 시작 (0이면 가장 최근 대전, 없으면 다음 대전)
+ *   서버 → 클라이언트
+ *     START  시드 u32 | 내 플레이어 u8 | 플레이어 수 u8
+ *     TICK   틱 u32 | 이벤트 u8 x N           (플레이어 << 2 | 방향, 리플레이와 같음)
+ *     END    승자 i8 | 종료 틱 u32 | 상태 해시 u64 (game_state_hash)
+ *
+ * 관전 프레임 (SPECTATE 뒤 서버 → 관전자, 맵을 담아 길므로 길이가 u16)
+ *   길이 u16 (종류 포함 바이트 수) | 종류 u8 | 틱 u32 | 내용
+ *     KEY    대전 번호 u32 | (반복 수 u8 | 칸 u8) x N   맵 전체 (행 우선, 같은 칸을 묶음)
+ *     DELTA  (칸 번호 u16 | 칸 u8) x N                   직전 프레임 뒤 바뀐 칸 (번호 = y * GAME_WIDTH + x)
+ *     END    승자 i8 | 맵 해시 u32 (netplay_map_hash)
+ * 관전자는 KEY로 맵을 새로 채우고 그 뒤의 DELTA를 차례로 적용합니다.
+ */
+
+#ifndef NETPLAY_H
+#define NETPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "game.h"
+
+#define NETPLAY_VERSION 1
+#define NETPLAY_DEFAULT_ADDRESS "127.0.0.1:7777"
+#define NETPLAY_MAX_MESSAGE 16         // 가장 긴 메시지 (END) 바이트 수
+#define NETPLAY_MALFORMED ((size_t)-1) // netplay_decode: 잘못된 메시지
+#define NETPLAY_MAP_CELLS (GAME_WIDTH * GAME_HEIGHT)
+#define NETPLAY_FRAME_HEADER 7         // 관전 프레임 머리 (길이 u16 + 종류 u8 + 틱 u32)
+#define NETPLAY_MAX_FRAME (NETPLAY_FRAME_HEADER + NETPLAY_MAP_CELLS * 3)  // 가장 긴 관전 프레임 (모든 칸이 바뀐 DELTA)
+
+/**
+ * @brief 메시지 종류
+ */
+typedef enum {
+    NETPLAY_MSG_HELLO = 0x01,
+    NETPLAY_MSG_TURN = 0x02,
+    NETPLAY_MSG_SPECTATE = 0x03,
+    NETPLAY_MSG_START = 0x81,
+    NETPLAY_MSG_TICK = 0x82,
+    NETPLAY_MSG_END = 0x83
+} netplay_msg_type_t;
+
+/**
+ * @brief 해석한 메시지 하나 (종류에 해당하는 필드만 유효)
+ */
+typedef struct {
+    netplay_msg_type_t type;
+    uint8_t version;               // HELLO
+    uint8_t direction;             // TURN
+    uint32_t match_id;             // SPECTATE
+    uint32_t seed;                 // START
+    uint8_t player_id;             // START
+    uint8_t num_players;           // START
+    uint32_t tick;                 // TICK: 틱 번호, END: 종료 틱
+    uint8_t events[MAX_PLAYERS];   // TICK: 방향 전환 (플레이어 << 2 | 방향)
+    int event_count;               // TICK
+    int8_t winner;                 // END (-1이면 승자 없음)
+    uint64_t hash;                 // END
+} netplay_message_t;
+
+/**
+ * @brief 관전 프레임 종류
+ */
+typedef enum {
+    NETPLAY_FRAME_KEY = 0x91,
+    NETPLAY_FRAME_DELTA = 0x92,
+    NETPLAY_FRAME_END = 0x93
+} netplay_frame_type_t;
+
+/**
+ * @brief 해석한 관전 프레임 하나 (cells는 받은 바이트를 가리킴)
+ */
+typedef struct {
+    netplay_frame_type_t type;
+    uint32_t tick;
+    uint32_t match_id;             // KEY
+    const uint8_t* cells;          // KEY: 묶은 맵, DELTA: 바뀐 칸
+    size_t cells_size;
+    int8_t winner;                 // END (-1이면 승자 없음)
+    uint32_t map_hash;             // END
+} netplay_frame_t;
+
+// 인코딩 (out은 NETPLAY_MAX_MESSAGE 바이트 이상, 쓴 바이트 수 반환)
+size_t netplay_encode_hello(uint8_t* out);
+size_t netplay_encode_turn(uint8_t* out, direction_t direction);
+size_t netplay_encode_spectate(uint8_t* out, uint32_t match_id);
+size_t netplay_encode_start(uint8_t* out, uint32_t seed, int player_id, int num_players);
+size_t netplay_encode_tick(uint8_t* out, uint32_t tick, const uint8_t* events, int event_count);
+size_t netplay_encode_end(uint8_t* out, const game_state_t* game, int winner_id);  // 기권이면 winner_id가 game과 다름
+
+// 관전 프레임 인코딩 (out은 NETPLAY_MAX_FRAME 바이트 이상, 쓴 바이트 수 반환)
+size_t netplay_encode_keyframe(uint8_t* out, const game_state_t* game, uint32_t match_id);
+size_t netplay_encode_delta(uint8_t* out, const game_state_t* game, char* shadow);  // shadow(맵 크기)와 다른 칸을 담고 shadow를 맞춤
+size_t netplay_encode_frame_end(uint8_t* out, const game_state_t* game, int winner_id);
+
+// 디코딩 (읽은 바이트 수, 아직 다 받지 못했으면 0, 잘못된 메시지면 NETPLAY_MALFORMED)
+size_t netplay_decode(const uint8_t* data, size_t size, netplay_message_t* out);
+size_t netplay_decode_frame(const uint8_t* data, size_t size, netplay_frame_t* out);
+
+// 관전자 쪽 맵 (map은 GAME_HEIGHT x GAME_WIDTH 칸, 행 우선)
+bool netplay_apply_frame(char* map, const netplay_frame_t* frame);
+uint32_t netplay_map_hash(const char* map);
+
+// 양쪽이 똑같이 진행하는 대전 시뮬레이션
+bool netplay_match_init(game_state_t* game, uint32_t seed);
+bool netplay_is_turn(const game_state_t* game, int player_id, direction_t direction);
+bool netplay_advance(game_state_t* game, const uint8_t* events, int event_count);
+
+#endif // NETPLAY_H
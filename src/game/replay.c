@@ -0,0 +1,607 @@
+#include "replay.h"
+#include "../platform/async_writer.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// varint 하나의 최대 바이트 수 (32비트 값)
+#define VARINT_MAX_BYTES 5
+#define REPLAY_STREAM_TAIL_SIZE 10     // 스트림의 마지막 레코드: 틱 차이 varint(1바이트 이상) + 끝 표시 + 상태 해시
+
+/**
+ * @brief 게임 중 기록기 내부 구조체
+ */
+struct replay_recorder {
+    async_writer_t* writer;        // 파일 기록 (게임 틱을 막지 않음)
+    uint32_t last_tick;            // 마지막으로 기록한 틱
+    uint32_t bytes_written;        // 지금까지 쓴 바이트 수 (색인 위치 계산용)
+    uint8_t* index;                // 키프레임 색인 (파일에 쓸 형식 그대로)
+    int index_count;               // 키프레임 수
+    int index_capacity;            // index 할당 크기 (항목 수)
+    uint8_t state_buffer[GAME_STATE_MAX_SERIALIZED_SIZE];  // 키프레임 직렬화 공간
+};
+
+/**
+ * @brief 탐색 리더 내부 구조체
+ */
+struct replay_reader {
+    mapped_file_t file;            // 매핑된 리플레이 파일
+    replay_header_t header;        // 초기 조건
+    const uint8_t* index;          // 키프레임 색인 시작
+    int index_count;               // 키프레임 수
+    const uint8_t* stream_end;     // 레코드 영역 끝 (색인 시작)
+    uint32_t final_tick;           // 종료 틱
+    game_state_t game;             // 탐색 결과 상태
+    bool game_ready;               // game이 초기화되었는지
+    const uint8_t* cursor;         // 다음에 읽을 레코드
+    uint32_t record_tick;          // 마지막으로 읽은 레코드의 틱
+    bool ended;                    // 끝 레코드를 읽었는지
+};
+
+/**
+ * @brief 부호 없는 정수를 LEB128 varint로 인코딩합니다
+ * @return 쓴 바이트 수
+ */
+static int encode_varint(uint8_t* out, uint32_t value) {
+    int size = 0;
+    while (value >= 0x80) {
+        out[size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = (uint8_t)value;
+    return size;
+}
+
+/**
+ * @brief LEB128 varint를 디코딩합니다
+ * @return 성공하면 true (입력이 잘렸거나 너무 길면 false)
+ */
+static bool decode_varint(const uint8_t** cursor, const uint8_t* end, uint32_t* value) {
+    uint32_t result = 0;
+    for (int i = 0; i < VARINT_MAX_BYTES && *cursor < end; i++) {
+        uint8_t byte = *(*cursor)++;
+        result |= (uint32_t)(byte & 0x7F) << (7 * i);
+        if (!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void put_u16(uint8_t* out, uint16_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+}
+
+static void put_u32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+static uint32_t get_u32(const uint8_t* in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+/**
+ * @brief 기록기에 데이터를 쓰고 파일 위치를 갱신합니다
+ */
+static void recorder_write(replay_recorder_t* recorder, const void* data, size_t size) {
+    async_writer_write(recorder->writer, data, size);
+    recorder->bytes_written += (uint32_t)size;
+}
+
+/**
+ * @brief 헤더 16바이트를 해석합니다
+ * @return 지원하는 형식이면 true
+ */
+static bool parse_header(const uint8_t* data, replay_header_t* header) {
+    if (memcmp(data, REPLAY_MAGIC, 4) != 0 || data[4] < 1 || data[4] > REPLAY_VERSION) {
+        return false;
+    }
+    header->version = data[4];
+    header->mode = (game_mode_t)data[5];
+    header->width = data[6];
+    header->height = data[7];
+    header->num_players = data[8];
+    header->personality = data[9];
+    header->game_speed = data[10] | data[11] << 8;
+    header->seed = get_u32(data + 12);
+    return true;
+}
+
+/**
+ * @brief 게임 기록을 시작합니다
+ *
+ * directory 안에 replay_<날짜>_<시각>_<시드>.snkr 파일을 만들고 헤더를 씁니다.
+ * 게임의 속도 설정이 끝난 뒤, 첫 틱 전에 호출해야 합니다.
+ *
+ * @param game 초기화된 게임 상태
+ * @param ai_personality AI 특성 (분석용으로만 기록, 재생에는 필요 없음)
+ * @param directory 저장할 디렉터리 (없으면 만듦)
+ * @return 기록기, 파일을 만들 수 없으면 NULL
+ */
+replay_recorder_t* replay_recorder_start(const game_state_t* game, int ai_personality, const char* directory) {
+    if (!game || !directory || !platform_create_directory(directory)) {
+        return NULL;
+    }
+
+    char path[256];
+    time_t now = time(NULL);
+    struct tm* local = localtime(&now);
+    char stamp[32] = "unknown";
+    if (local) {
+        strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", local);
+    }
+    snprintf(path, sizeof(path), "%s/replay_%s_%08x.snkr", directory, stamp, (unsigned)game->seed);
+
+    replay_recorder_t* recorder = calloc(1, sizeof(replay_recorder_t));
+    if (!recorder) return NULL;
+
+    recorder->writer = async_writer_open(path);
+    if (!recorder->writer) {
+        free(recorder);
+        return NULL;
+    }
+
+    uint8_t header[REPLAY_HEADER_SIZE] = {0};
+    memcpy(header, REPLAY_MAGIC, 4);
+    header[4] = REPLAY_VERSION;
+    header[5] = (uint8_t)game->mode;
+    header[6] = GAME_WIDTH;
+    header[7] = GAME_HEIGHT;
+    header[8] = (uint8_t)game->num_players;
+    header[9] = (uint8_t)ai_personality;
+    put_u16(header + 10, (uint16_t)game->game_speed);
+    put_u32(header + 12, game->seed);
+    recorder_write(recorder, header, sizeof(header));
+
+    return recorder;
+}
+
+/**
+ * @brief 방향 전환 하나를 기록합니다 (시뮬레이션 스레드에서 호출)
+ *
+ * @param recorder 기록기 (NULL이면 무시)
+ * @param tick 전환이 적용되는 틱
+ * @param player_id 플레이어
+ * @param direction 새 방향
+ */
+void replay_record_turn(replay_recorder_t* recorder, uint32_t tick, int player_id, direction_t direction) {
+    if (!recorder) return;
+
+    uint8_t record[VARINT_MAX_BYTES + 1];
+    int size = encode_varint(record, tick - recorder->last_tick);
+    record[size++] = (uint8_t)(player_id << 2 | (int)direction);
+    recorder_write(recorder, record, (size_t)size);
+
+    recorder->last_tick = tick;
+}
+
+/**
+ * @brief 틱이 끝날 때 호출되어, 주기가 되면 키프레임을 기록합니다
+ *
+ * 키프레임은 game->tick_count번째 틱을 시작하기 직전의 상태이며,
+ * 같은 틱의 방향 전환 레코드보다 앞에 놓입니다.
+ *
+ * @param recorder 기록기 (NULL이면 무시)
+ * @param game 방금 틱을 마친 게임 상태
+ */
+void replay_record_tick_end(replay_recorder_t* recorder, const game_state_t* game) {
+    if (!recorder || game->tick_count % REPLAY_KEYFRAME_INTERVAL != 0) return;
+
+    size_t state_size = game_serialize_state(game, recorder->state_buffer, sizeof(recorder->state_buffer));
+    if (state_size == 0) return;
+
+    if (recorder->index_count >= recorder->index_capacity) {
+        int capacity = recorder->index_capacity ? recorder->index_capacity * 2 : 16;
+        uint8_t* index = realloc(recorder->index, (size_t)capacity * REPLAY_INDEX_ENTRY_SIZE);
+        if (!index) return;  // 키프레임 없이도 리플레이는 유효
+        recorder->index = index;
+        recorder->index_capacity = capacity;
+    }
+
+    uint8_t record[VARINT_MAX_BYTES + 1 + 4];
+    int size = encode_varint(record, game->tick_count - recorder->last_tick);
+    record[size++] = REPLAY_KEYFRAME_MARKER;
+    put_u32(record + size, (uint32_t)state_size);
+    size += 4;
+    recorder_write(recorder, record, (size_t)size);
+
+    uint32_t state_offset = recorder->bytes_written;
+    recorder_write(recorder, recorder->state_buffer, state_size);
+    recorder->last_tick = game->tick_count;
+
+    uint8_t* entry = recorder->index + (size_t)recorder->index_count++ * REPLAY_INDEX_ENTRY_SIZE;
+    put_u32(entry, game->tick_count);
+    put_u32(entry + 4, state_offset);
+    put_u32(entry + 8, (uint32_t)state_size);
+    put_u32(entry + 12, recorder->bytes_written);
+}
+
+/**
+ * @brief 끝 레코드와 상태 해시를 쓰고 기록을 마칩니다
+ *
+ * 시뮬레이션이 멈춘 뒤에 호출해야 합니다. 기록기는 해제됩니다.
+ *
+ * @param recorder 기록기 (NULL이면 무시)
+ * @param game 종료된 게임 상태
+ * @return 파일을 문제없이 썼으면 true
+ */
+bool replay_recorder_finish(replay_recorder_t* recorder, const game_state_t* game) {
+    if (!recorder) return false;
+
+    uint8_t record[VARINT_MAX_BYTES + 1 + 8];
+    int size = encode_varint(record, game->tick_count - recorder->last_tick);
+    record[size++] = REPLAY_END_MARKER;
+
+    uint64_t hash = game_state_hash(game);
+    for (int i = 0; i < 8; i++) {
+        record[size++] = (uint8_t)(hash >> (8 * i));
+    }
+    recorder_write(recorder, record, (size_t)size);
+
+    // 키프레임 색인과 꼬리말
+    uint32_t index_offset = recorder->bytes_written;
+    uint8_t count[4];
+    put_u32(count, (uint32_t)recorder->index_count);
+    recorder_write(recorder, count, sizeof(count));
+    recorder_write(recorder, recorder->index, (size_t)recorder->index_count * REPLAY_INDEX_ENTRY_SIZE);
+
+    uint8_t footer[REPLAY_FOOTER_SIZE];
+    put_u32(footer, game->tick_count);
+    put_u32(footer + 4, index_offset);
+    memcpy(footer + 8, REPLAY_INDEX_MAGIC, 4);
+    recorder_write(recorder, footer, sizeof(footer));
+
+    bool ok = async_writer_close(recorder->writer);
+    free(recorder->index);
+    free(recorder);
+    return ok;
+}
+
+/**
+ * @brief 리플레이 파일 전체를 읽어 해석합니다
+ *
+ * @param path 파일 경로
+ * @param replay 결과 (replay_free로 해제)
+ * @return 형식이 올바르면 true
+ */
+bool replay_load(const char* path, replay_t* replay) {
+    if (!path || !replay) return false;
+    memset(replay, 0, sizeof(replay_t));
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    fseek(file, 0, SEEK_END);
+    long file_size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (file_size < REPLAY_HEADER_SIZE) {
+        fclose(file);
+        return false;
+    }
+
+    uint8_t* data = malloc((size_t)file_size);
+    bool read_ok = data && fread(data, 1, (size_t)file_size, file) == (size_t)file_size;
+    fclose(file);
+    if (!read_ok || !parse_header(data, &replay->header)) {
+        free(data);
+        return false;
+    }
+    const replay_header_t* header = &replay->header;
+
+    // 레코드는 최소 2바이트이므로 남은 크기의 절반이면 충분
+    int capacity = (int)(file_size - REPLAY_HEADER_SIZE) / 2 + 1;
+    replay->events = malloc(sizeof(replay_event_t) * (size_t)capacity);
+    if (!replay->events) {
+        free(data);
+        return false;
+    }
+
+    const uint8_t* cursor = data + REPLAY_HEADER_SIZE;
+    const uint8_t* end = data + file_size;
+    uint32_t tick = 0;
+    bool finished = false;
+
+    while (!finished) {
+        uint32_t delta;
+        if (!decode_varint(&cursor, end, &delta) || cursor >= end) break;
+        tick += delta;
+
+        uint8_t event = *cursor++;
+        if (event == REPLAY_END_MARKER) {
+            if (end - cursor < 8) break;
+            replay->final_tick = tick;
+            for (int i = 0; i < 8; i++) {
+                replay->final_hash |= (uint64_t)cursor[i] << (8 * i);
+            }
+            finished = true;
+            break;
+        }
+        if (event == REPLAY_KEYFRAME_MARKER) {
+            // 처음부터 재생할 때는 키프레임이 필요 없으므로 건너뜀
+            if (end - cursor < 4 || (uint32_t)(end - cursor - 4) < get_u32(cursor)) break;
+            cursor += 4 + get_u32(cursor);
+            continue;
+        }
+
+        if (replay->event_count >= capacity || (event >> 2) >= header->num_players) break;
+        replay_event_t* out = &replay->events[replay->event_count++];
+        out->tick = tick;
+        out->player_id = (uint8_t)(event >> 2);
+        out->direction = (direction_t)(event & 0x3);
+    }
+
+    free(data);
+    if (!finished) {
+        replay_free(replay);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief replay_load로 읽은 리플레이 해제
+ *
+ * @param replay 리플레이
+ */
+void replay_free(replay_t* replay) {
+    if (!replay) return;
+    free(replay->events);
+    replay->events = NULL;
+    replay->event_count = 0;
+}
+
+/**
+ * @brief 리플레이를 game_update로 다시 실행하고 결과를 검증합니다
+ *
+ * 가상 시계로 기록된 초기 조건에서 게임을 만들고, 각 틱 직전에 기록된
+ * 방향 전환을 적용합니다. 종료 틱까지 실행한 뒤의 상태 해시가 기록과
+ * 같으면 원래 게임이 그대로 재현된 것입니다.
+ *
+ * @param replay 읽어 들인 리플레이
+ * @param game 재생에 쓸 게임 상태 (끝나면 game_cleanup으로 정리)
+ * @return 상태 해시가 일치하면 true
+ */
+bool replay_play(const replay_t* replay, game_state_t* game) {
+    if (!replay || !game) return false;
+    if (replay->header.width != GAME_WIDTH || replay->header.height != GAME_HEIGHT) {
+        return false;
+    }
+
+    game_clock_t clock;
+    game_clock_init(&clock, GAME_CLOCK_VIRTUAL);
+    if (!game_init_with_seed(game, replay->header.mode, &clock, replay->header.seed)) {
+        return false;
+    }
+    game->game_speed = replay->header.game_speed;
+
+    int next_event = 0;
+    while (game->tick_count < replay->final_tick) {
+        // 이번 틱에 적용된 방향 전환 복원
+        while (next_event < replay->event_count && replay->events[next_event].tick == game->tick_count) {
+            const replay_event_t* event = &replay->events[next_event++];
+            if (event->player_id < game->num_players) {
+                game->players[event->player_id].next_direction = event->direction;
+            }
+        }
+
+        game_clock_advance_us(&game->clock, (uint64_t)game->game_speed * 1000);
+        if (!game_update(game)) break;
+    }
+
+    return game->tick_count == replay->final_tick && game_state_hash(game) == replay->final_hash;
+}
+
+/**
+ * @brief 리플레이 파일을 매핑하고 키프레임 색인을 확인합니다
+ *
+ * @param path 버전 2 리플레이 파일 경로
+ * @return 리더, 파일이 없거나 색인이 없으면 NULL
+ */
+replay_reader_t* replay_reader_open(const char* path) {
+    replay_reader_t* reader = calloc(1, sizeof(replay_reader_t));
+    if (!reader) return NULL;
+
+    if (!platform_map_file(path, &reader->file)) {
+        free(reader);
+        return NULL;
+    }
+
+    const uint8_t* data = reader->file.data;
+    size_t size = reader->file.size;
+    bool valid = size >= REPLAY_HEADER_SIZE + 4 + REPLAY_FOOTER_SIZE &&
+                 parse_header(data, &reader->header) && reader->header.version >= 2 &&
+                 memcmp(data + size - 4, REPLAY_INDEX_MAGIC, 4) == 0;
+
+    if (valid) {
+        const uint8_t* footer = data + size - REPLAY_FOOTER_SIZE;
+        uint32_t index_offset = get_u32(footer + 4);
+        reader->final_tick = get_u32(footer);
+
+        // 색인은 헤더와 레코드 스트림(끝 표시 + 상태 해시 8바이트로 끝남) 뒤에 옴
+        // 오프셋은 파일에서 읽은 값이므로 size_t로 계산해 넘침을 막음
+        valid = (size_t)index_offset >= REPLAY_HEADER_SIZE + REPLAY_STREAM_TAIL_SIZE &&
+                (size_t)index_offset + 4 <= size - REPLAY_FOOTER_SIZE &&
+                data[index_offset - REPLAY_STREAM_TAIL_SIZE + 1] == REPLAY_END_MARKER;
+        if (valid) {
+            size_t index_count = get_u32(data + index_offset);
+            valid = index_count <= INT_MAX &&
+                    index_count * REPLAY_INDEX_ENTRY_SIZE == size - REPLAY_FOOTER_SIZE - (size_t)index_offset - 4;
+            reader->index_count = valid ? (int)index_count : 0;
+            reader->index = data + index_offset + 4;
+            reader->stream_end = data + index_offset;
+        }
+    }
+
+    if (!valid) {
+        platform_unmap_file(&reader->file);
+        free(reader);
+        return NULL;
+    }
+    return reader;
+}
+
+/**
+ * @brief 리더를 닫고 매핑을 해제합니다
+ *
+ * @param reader 리더
+ */
+void replay_reader_close(replay_reader_t* reader) {
+    if (!reader) return;
+    if (reader->game_ready) {
+        game_cleanup(&reader->game);
+    }
+    platform_unmap_file(&reader->file);
+    free(reader);
+}
+
+const replay_header_t* replay_reader_header(const replay_reader_t* reader) {
+    return reader ? &reader->header : NULL;
+}
+
+uint32_t replay_reader_final_tick(const replay_reader_t* reader) {
+    return reader ? reader->final_tick : 0;
+}
+
+/**
+ * @brief 마지막으로 탐색한 틱의 게임 상태
+ *
+ * @param reader 리더
+ * @return 상태 (replay_reader_seek 전이면 NULL)
+ */
+const game_state_t* replay_reader_state(const replay_reader_t* reader) {
+    return reader && reader->game_ready ? &reader->game : NULL;
+}
+
+/**
+ * @brief target 이하인 마지막 키프레임 항목을 찾습니다 (이진 탐색)
+ * @return 색인 항목, 없으면 NULL
+ */
+static const uint8_t* find_keyframe(const replay_reader_t* reader, uint32_t target) {
+    int low = 0;
+    int high = reader->index_count - 1;
+    const uint8_t* found = NULL;
+
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        const uint8_t* entry = reader->index + (size_t)mid * REPLAY_INDEX_ENTRY_SIZE;
+        if (get_u32(entry) <= target) {
+            found = entry;
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief 키프레임(없으면 게임 시작)에서 탐색 상태를 다시 만듭니다
+ */
+static bool restore_keyframe(replay_reader_t* reader, const uint8_t* entry) {
+    if (reader->game_ready) {
+        game_cleanup(&reader->game);
+        reader->game_ready = false;
+    }
+
+    game_clock_t clock;
+    game_clock_init(&clock, GAME_CLOCK_VIRTUAL);
+    if (!game_init_with_seed(&reader->game, reader->header.mode, &clock, reader->header.seed)) {
+        return false;
+    }
+    reader->game_ready = true;
+    reader->game.game_speed = reader->header.game_speed;
+    reader->cursor = reader->file.data + REPLAY_HEADER_SIZE;
+    reader->record_tick = 0;
+    reader->ended = false;
+
+    if (!entry) return true;
+
+    uint32_t state_offset = get_u32(entry + 4);
+    uint32_t state_size = get_u32(entry + 8);
+    uint32_t stream_offset = get_u32(entry + 12);
+    const uint8_t* data = reader->file.data;
+    if (state_offset < REPLAY_HEADER_SIZE || stream_offset < REPLAY_HEADER_SIZE ||
+        (size_t)state_offset + state_size > (size_t)(reader->stream_end - data) ||
+        stream_offset > (size_t)(reader->stream_end - data) ||
+        !game_deserialize_state(&reader->game, data + state_offset, state_size)) {
+        return false;
+    }
+
+    reader->cursor = data + stream_offset;
+    reader->record_tick = get_u32(entry);
+    return true;
+}
+
+/**
+ * @brief 현재 틱에 적용할 방향 전환을 레코드에서 읽어 적용합니다
+ */
+static void apply_records_for_tick(replay_reader_t* reader) {
+    game_state_t* game = &reader->game;
+
+    while (!reader->ended && reader->cursor < reader->stream_end) {
+        const uint8_t* cursor = reader->cursor;
+        uint32_t delta;
+        if (!decode_varint(&cursor, reader->stream_end, &delta) || cursor >= reader->stream_end) {
+            reader->ended = true;
+            return;
+        }
+        if (reader->record_tick + delta != game->tick_count) {
+            return;  // 다음 레코드는 이후 틱의 것
+        }
+
+        uint8_t event = *cursor++;
+        if (event == REPLAY_END_MARKER) {
+            reader->ended = true;
+        } else if (event == REPLAY_KEYFRAME_MARKER) {
+            // 이미 시뮬레이션으로 같은 상태에 도달했으므로 건너뜀
+            if (reader->stream_end - cursor < 4 ||
+                get_u32(cursor) > (size_t)(reader->stream_end - cursor) - 4) {
+                reader->ended = true;
+                return;
+            }
+            cursor += 4 + get_u32(cursor);
+        } else if ((event >> 2) < game->num_players) {
+            game->players[event >> 2].next_direction = (direction_t)(event & 0x3);
+        }
+
+        reader->record_tick += delta;
+        reader->cursor = cursor;
+    }
+}
+
+/**
+ * @brief 지정한 틱을 시작하기 직전의 상태로 이동합니다
+ *
+ * 가까운 키프레임으로 바로 이동한 뒤 남은 틱(최대 REPLAY_KEYFRAME_INTERVAL - 1)만
+ * game_update로 시뮬레이션합니다. 이미 그 키프레임 이후의 앞쪽 틱에 있으면
+ * 키프레임을 다시 읽지 않고 이어서 진행하므로 순서대로 넘겨 보기도 빠릅니다.
+ *
+ * @param reader 리더
+ * @param tick 목표 틱 (종료 틱을 넘으면 종료 틱)
+ * @return 목표 틱에 도달했으면 true
+ */
+bool replay_reader_seek(replay_reader_t* reader, uint32_t tick) {
+    if (!reader) return false;
+    if (tick > reader->final_tick) tick = reader->final_tick;
+
+    const uint8_t* entry = find_keyframe(reader, tick);
+    uint32_t keyframe_tick = entry ? get_u32(entry) : 0;
+
+    bool can_continue = reader->game_ready && reader->game.tick_count <= tick &&
+                        reader->game.tick_count >= keyframe_tick;
+    if (!can_continue && !restore_keyframe(reader, entry)) {
+        return false;
+    }
+
+    game_state_t* game = &reader->game;
+    while (game->tick_count < tick) {
+        apply_records_for_tick(reader);
+        game_clock_advance_us(&game->clock, (uint64_t)game->game_speed * 1000);
+        if (!game_update(game)) break;
+    }
+    return game->tick_count == tick;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file replay.h
+ * @brief 시드와 방향 전환만 담는 압축 바이너리 리플레이
+ *
+ * 게임 시뮬레이션은 시드가 같고 같은 틱에 같은 방향 전환이 적용되면
+ * 똑같이 진행되므로, 리플레이에는 초기 조건과 방향 전환 기록만 남깁니다.
+ *
+ * 파일 형식 (리틀 엔디언):
+ *   헤더 16바이트: "SNKR" | 버전 u8 | 모드 u8 | 가로 u8 | 세로 u8 |
+ *                  플레이어 수 u8 | AI 특성 u8 | 속도(ms) u16 | 시드 u32
+ *   레코드: 직전 레코드와의 틱 차이(varint) | 이벤트 u8 (플레이어 << 2 | 방향)
+ *   키프레임 (버전 2): 틱 차이(varint) | 0xFE | 크기 u32 | game_serialize_state 결과
+ *   끝 레코드: 마지막 레코드부터 종료 틱까지의 차이(varint) | 0xFF |
+ *              종료 시점 상태 해시 u64 (game_state_hash)
+ *   색인 (버전 2): 키프레임 수 u32 | 키프레임마다 (틱 u32 | 상태 위치 u32 |
+ *                  상태 크기 u32 | 다음 레코드 위치 u32) |
+ *                  종료 틱 u32 | 색인 위치 u32 | "SNKI"
+ *
+ * 키프레임은 REPLAY_KEYFRAME_INTERVAL 틱마다 그 틱을 시작하기 직전의 상태를
+ * 담으므로, 리더는 가까운 키프레임에서 시작해 남은 틱만 시뮬레이션합니다.
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "game.h"
+
+#define REPLAY_MAGIC "SNKR"
+#define REPLAY_VERSION 2               // 1: 방향 전환만, 2: 키프레임과 색인 추가
+#define REPLAY_HEADER_SIZE 16
+#define REPLAY_END_MARKER 0xFF         // 이벤트 바이트 자리에 오면 기록 끝
+#define REPLAY_KEYFRAME_MARKER 0xFE    // 이벤트 바이트 자리에 오면 키프레임
+#define REPLAY_KEYFRAME_INTERVAL 256   // 키프레임 간격 (틱)
+#define REPLAY_INDEX_MAGIC "SNKI"
+#define REPLAY_INDEX_ENTRY_SIZE 16
+#define REPLAY_FOOTER_SIZE 12
+#define REPLAY_DIRECTORY "replays"     // 기본 저장 위치
+
+/**
+ * @brief 리플레이 헤더 (게임 초기 조건)
+ */
+typedef struct {
+    uint8_t version;               // 형식 버전
+    game_mode_t mode;              // 게임 모드
+    int width;                     // 맵 가로 크기
+    int height;                    // 맵 세로 크기
+    int num_players;               // 플레이어 수
+    int game_speed;                // 시작 속도 (밀리초)
+    uint32_t seed;                 // 게임 난수 시드
+    int personality;               // AI 특성 (ui.h의 ai_personality, 예전 파일은 0)
+} replay_header_t;
+
+/**
+ * @brief 방향 전환 한 번
+ */
+typedef struct {
+    uint32_t tick;                 // 전환이 적용된 틱 (0부터)
+    uint8_t player_id;             // 플레이어
+    direction_t direction;         // 새 방향
+} replay_event_t;
+
+/**
+ * @brief 메모리에 읽어 들인 리플레이
+ */
+typedef struct {
+    replay_header_t header;        // 초기 조건
+    replay_event_t* events;        // 방향 전환 (틱 순)
+    int event_count;               // 방향 전환 수
+    uint32_t final_tick;           // 게임이 끝난 틱 수
+    uint64_t final_hash;           // 종료 시점 상태 해시
+} replay_t;
+
+/**
+ * @brief 게임 중 기록기 (불투명 타입)
+ */
+typedef struct replay_recorder replay_recorder_t;
+
+/**
+ * @brief 메모리 매핑 기반 탐색 리더 (불투명 타입)
+ */
+typedef struct replay_reader replay_reader_t;
+
+// 기록
+replay_recorder_t* replay_recorder_start(const game_state_t* game, int ai_personality, const char* directory);
+void replay_record_turn(replay_recorder_t* recorder, uint32_t tick, int player_id, direction_t direction);
+void replay_record_tick_end(replay_recorder_t* recorder, const game_state_t* game);
+bool replay_recorder_finish(replay_recorder_t* recorder, const game_state_t* game);
+
+// 읽기 및 재생
+bool replay_load(const char* path, replay_t* replay);
+void replay_free(replay_t* replay);
+bool replay_play(const replay_t* replay, game_state_t* game);
+
+// 임의 틱 탐색 (버전 2 파일)
+replay_reader_t* replay_reader_open(const char* path);
+void replay_reader_close(replay_reader_t* reader);
+const replay_header_t* replay_reader_header(const replay_reader_t* reader);
+uint32_t replay_reader_final_tick(const replay_reader_t* reader);
+bool replay_reader_seek(replay_reader_t* reader, uint32_t tick);
+const game_state_t* replay_reader_state(const replay_reader_t* reader);
+
+#endif // REPLAY_H
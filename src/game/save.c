@@ -0,0 +1,323 @@
+#include "save.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 좌표는 6비트, 뱀 길이는 11비트에 담음 (40x40 맵 기준)
+#define SAVE_COORD_BITS 6
+#define SAVE_LENGTH_BITS 11
+
+// 맵 칸의 2비트 코드
+#define SAVE_CELL_EMPTY 0
+#define SAVE_CELL_APPLE 1
+#define SAVE_CELL_OBSTACLE 2
+#define SAVE_CELL_SNAKE 3
+
+/**
+ * @brief 비트 단위 쓰기/읽기 커서
+ */
+typedef struct {
+    uint8_t* data;                 // 버퍼 (읽을 때는 const로만 사용)
+    size_t capacity;               // 버퍼 크기 (바이트)
+    size_t bit_pos;                // 다음 비트 위치
+    bool overflow;                 // 버퍼를 넘어섰는지
+} bit_cursor_t;
+
+static void write_bits(bit_cursor_t* cursor, uint32_t value, int count) {
+    // 바이트 경계까지 남은 비트씩 나눠서 씀
+    while (count > 0) {
+        size_t byte = cursor->bit_pos >> 3;
+        if (byte >= cursor->capacity) {
+            cursor->overflow = true;
+            return;
+        }
+        int shift = (int)(cursor->bit_pos & 7);
+        int chunk = 8 - shift < count ? 8 - shift : count;
+        uint8_t mask = (uint8_t)(((1u << chunk) - 1) << shift);
+        cursor->data[byte] = (uint8_t)((cursor->data[byte] & ~mask) | ((value << shift) & mask));
+        value >>= chunk;
+        count -= chunk;
+        cursor->bit_pos += (size_t)chunk;
+    }
+}
+
+static uint32_t read_bits(bit_cursor_t* cursor, int count) {
+    uint32_t value = 0;
+    int filled = 0;
+    while (filled < count) {
+        size_t byte = cursor->bit_pos >> 3;
+        if (byte >= cursor->capacity) {
+            cursor->overflow = true;
+            return 0;
+        }
+        int shift = (int)(cursor->bit_pos & 7);
+        int chunk = 8 - shift < count - filled ? 8 - shift : count - filled;
+        uint32_t bits = (uint32_t)(cursor->data[byte] >> shift) & ((1u << chunk) - 1);
+        value |= bits << filled;
+        filled += chunk;
+        cursor->bit_pos += (size_t)chunk;
+    }
+    return value;
+}
+
+/**
+ * @brief 이웃한 두 마디 사이의 방향을 구합니다
+ */
+static direction_t segment_direction(position_t from, position_t to) {
+    if (to.x > from.x) return DIR_RIGHT;
+    if (to.x < from.x) return DIR_LEFT;
+    if (to.y < from.y) return DIR_UP;
+    return DIR_DOWN;
+}
+
+static uint32_t encode_cell(char cell) {
+    switch (cell) {
+        case CELL_APPLE: return SAVE_CELL_APPLE;
+        case CELL_OBSTACLE: return SAVE_CELL_OBSTACLE;
+        case CELL_SNAKE_HEAD:
+        case CELL_SNAKE_BODY: return SAVE_CELL_SNAKE;
+        default: return SAVE_CELL_EMPTY;
+    }
+}
+
+/**
+ * @brief 게임 상태를 비트 압축 형식으로 저장합니다
+ *
+ * 틱마다 호출해도 될 만큼 가볍도록 할당 없이 버퍼에 직접 씁니다.
+ *
+ * @param game 게임 상태 포인터
+ * @param out 출력 버퍼
+ * @param capacity 출력 버퍼 크기 (SAVE_MAX_SIZE면 항상 충분)
+ * @return 쓴 바이트 수, 버퍼가 부족하면 0
+ */
+size_t game_save_to_buffer(const game_state_t* game, uint8_t* out, size_t capacity) {
+    if (!game || !out || capacity < 5) return 0;
+
+    memcpy(out, SAVE_MAGIC, 4);
+    out[4] = SAVE_VERSION;
+
+    bit_cursor_t cursor = {out + 5, capacity - 5, 0, false};
+    write_bits(&cursor, game->tick_count, 32);
+    write_bits(&cursor, game->rng_state, 32);
+    write_bits(&cursor, game->seed, 32);
+    write_bits(&cursor, (uint32_t)game->game_speed, 16);
+    write_bits(&cursor, (uint32_t)game->apples_count, 16);
+    write_bits(&cursor, (uint32_t)game->obstacles_count, 16);
+    write_bits(&cursor, (uint32_t)game->apples_eaten, 32);
+    write_bits(&cursor, (uint32_t)game_get_play_time((game_state_t*)game), 32);
+    write_bits(&cursor, (uint32_t)game->mode, 2);
+    write_bits(&cursor, (uint32_t)game->state, 2);
+    write_bits(&cursor, game->game_over ? 1 : 0, 1);
+    write_bits(&cursor, (uint32_t)(game->winner_id + 1), 2);
+    write_bits(&cursor, (uint32_t)game->num_players, 4);
+
+    for (int i = 0; i < game->num_players; i++) {
+        const snake_t* snake = &game->players[i];
+        write_bits(&cursor, (uint32_t)snake->type, 2);
+        write_bits(&cursor, (uint32_t)snake->direction, 2);
+        write_bits(&cursor, snake->alive ? 1 : 0, 1);
+        write_bits(&cursor, (uint32_t)snake->score, 32);
+        write_bits(&cursor, (uint32_t)snake->length, SAVE_LENGTH_BITS);
+        write_bits(&cursor, (uint32_t)snake->head->pos.x, SAVE_COORD_BITS);
+        write_bits(&cursor, (uint32_t)snake->head->pos.y, SAVE_COORD_BITS);
+
+        // 몸통은 머리에서부터 마디 사이의 방향만 2비트씩
+        for (const snake_node_t* node = snake->head; node->next; node = node->next) {
+            write_bits(&cursor, (uint32_t)segment_direction(node->pos, node->next->pos), 2);
+        }
+    }
+
+    // 맵은 16칸(32비트)씩 모아서 씀
+    const char* cells = &game->map[0][0];
+    for (int i = 0; i < GAME_WIDTH * GAME_HEIGHT; i += 16) {
+        int count = GAME_WIDTH * GAME_HEIGHT - i < 16 ? GAME_WIDTH * GAME_HEIGHT - i : 16;
+        uint32_t packed = 0;
+        for (int j = 0; j < count; j++) {
+            packed |= encode_cell(cells[i + j]) << (j * 2);
+        }
+        write_bits(&cursor, packed, count * 2);
+    }
+
+    if (cursor.overflow) return 0;
+    return 5 + (cursor.bit_pos + 7) / 8;
+}
+
+/**
+ * @brief 저장된 뱀 하나를 읽어 몸통 리스트를 다시 만듭니다
+ */
+static bool load_snake(bit_cursor_t* cursor, snake_t* snake) {
+    snake->type = (player_type_t)read_bits(cursor, 2);
+    snake->direction = (direction_t)read_bits(cursor, 2);
+    snake->next_direction = snake->direction;
+    snake->alive = read_bits(cursor, 1) != 0;
+    snake->score = (int)read_bits(cursor, 32);
+    int length = (int)read_bits(cursor, SAVE_LENGTH_BITS);
+    position_t pos = {(int)read_bits(cursor, SAVE_COORD_BITS), (int)read_bits(cursor, SAVE_COORD_BITS)};
+    if (cursor->overflow || length < 1 || length > MAX_SNAKE_LENGTH) return false;
+
+    // 기존 몸통 해제
+    snake_node_t* node = snake->head;
+    while (node) {
+        snake_node_t* next = node->next;
+        free(node);
+        node = next;
+    }
+    snake->head = snake->tail = NULL;
+    snake->length = 0;
+
+    snake_node_t* prev = NULL;
+    for (int n = 0; n < length; n++) {
+        if (n > 0) {
+            pos = get_next_position(pos, (direction_t)read_bits(cursor, 2));
+        }
+        if (cursor->overflow || !is_valid_position(pos)) return false;
+
+        node = malloc(sizeof(snake_node_t));
+        if (!node) return false;
+        node->pos = pos;
+        node->next = NULL;
+
+        if (prev) {
+            prev->next = node;
+        } else {
+            snake->head = node;
+        }
+        prev = node;
+        snake->tail = node;
+        snake->length++;
+    }
+
+    snake->last_pos = snake->head->pos;
+    snake->last_tail_pos = snake->tail->pos;
+    return true;
+}
+
+/**
+ * @brief 저장된 게임 상태로 게임을 초기화합니다
+ *
+ * 저장된 모드와 시드로 game_init_with_seed를 호출한 뒤 나머지 상태를 덮어쓰므로
+ * game은 초기화되지 않은 상태여야 합니다 (끝나면 game_cleanup으로 정리).
+ * 플레이 시간은 이어서 흐릅니다.
+ *
+ * @param game 채울 게임 상태
+ * @param clock 사용할 게임 시계
+ * @param data 저장 데이터
+ * @param size 데이터 크기
+ * @return 형식이 올바르면 true (실패해도 game_cleanup은 안전)
+ */
+bool game_load_from_buffer(game_state_t* game, const game_clock_t* clock, const uint8_t* data, size_t size) {
+    if (!game || !clock || !data || size < 5) return false;
+    if (memcmp(data, SAVE_MAGIC, 4) != 0 || data[4] != SAVE_VERSION) return false;
+
+    bit_cursor_t cursor = {(uint8_t*)data + 5, size - 5, 0, false};
+    uint32_t tick_count = read_bits(&cursor, 32);
+    uint32_t rng_state = read_bits(&cursor, 32);
+    uint32_t seed = read_bits(&cursor, 32);
+    int game_speed = (int)read_bits(&cursor, 16);
+    int apples_count = (int)read_bits(&cursor, 16);
+    int obstacles_count = (int)read_bits(&cursor, 16);
+    int apples_eaten = (int)read_bits(&cursor, 32);
+    uint32_t play_time = read_bits(&cursor, 32);
+    game_mode_t mode = (game_mode_t)read_bits(&cursor, 2);
+    game_state_enum_t state = (game_state_enum_t)read_bits(&cursor, 2);
+    bool game_over = read_bits(&cursor, 1) != 0;
+    int winner_id = (int)read_bits(&cursor, 2) - 1;
+    int num_players = (int)read_bits(&cursor, 4);
+    if (cursor.overflow) return false;
+
+    if (!game_init_with_seed(game, mode, clock, seed)) return false;
+    if (num_players != game->num_players) return false;
+
+    for (int i = 0; i < num_players; i++) {
+        if (!load_snake(&cursor, &game->players[i])) return false;
+    }
+
+    static const char cell_types[4] = {CELL_EMPTY, CELL_APPLE, CELL_OBSTACLE, CELL_SNAKE_BODY};
+    char* cells = &game->map[0][0];
+    for (int i = 0; i < GAME_WIDTH * GAME_HEIGHT; i += 16) {
+        int count = GAME_WIDTH * GAME_HEIGHT - i < 16 ? GAME_WIDTH * GAME_HEIGHT - i : 16;
+        uint32_t packed = read_bits(&cursor, count * 2);
+        for (int j = 0; j < count; j++) {
+            cells[i + j] = cell_types[(packed >> (j * 2)) & 3];
+        }
+    }
+    if (cursor.overflow) return false;
+
+    // 머리 칸은 뱀 정보로 복원
+    for (int i = 0; i < num_players; i++) {
+        position_t head = game->players[i].head->pos;
+        game->map[head.y][head.x] = CELL_SNAKE_HEAD;
+    }
+
+    game->tick_count = tick_count;
+    game->rng_state = rng_state;
+    game->game_speed = game_speed;
+    game->apples_count = apples_count;
+    game->obstacles_count = obstacles_count;
+    game->apples_eaten = apples_eaten;
+    game->game_over = game_over;
+    game->winner_id = winner_id;
+    game->play_time_offset = play_time;
+    game->game_end_time = game->game_start_time;  // 끝난 게임은 저장 시점 시간에서 멈춤
+
+    // 일시정지 상태로 저장했으면 지금부터 일시정지 시간을 잼
+    game->state = state;
+    if (state == GAME_STATE_PAUSED) {
+        game->pause_start_time = game_clock_now_ms(&game->clock);
+    }
+    return true;
+}
+
+/**
+ * @brief 게임 상태를 파일로 저장합니다
+ *
+ * 임시 파일에 쓴 뒤 이름을 바꾸므로 도중에 종료되어도 이전 저장은 남습니다.
+ *
+ * @param game 게임 상태 포인터
+ * @param path 저장 경로
+ * @return 성공하면 true
+ */
+bool game_save_to_file(const game_state_t* game, const char* path) {
+    if (!game || !path) return false;
+
+    uint8_t buffer[SAVE_MAX_SIZE];
+    size_t size = game_save_to_buffer(game, buffer, sizeof(buffer));
+    if (size == 0) return false;
+
+    char temp_path[512];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) return false;
+    bool ok = fwrite(buffer, 1, size, file) == size;
+    ok = fclose(file) == 0 && ok;
+
+    // Windows의 rename은 대상이 있으면 실패하므로 먼저 지움
+    if (ok) {
+        remove(path);
+        ok = rename(temp_path, path) == 0;
+    }
+    if (!ok) remove(temp_path);
+    return ok;
+}
+
+/**
+ * @brief 파일에서 게임 상태를 불러옵니다
+ *
+ * @param game 채울 게임 상태 (초기화되지 않은 상태)
+ * @param clock 사용할 게임 시계
+ * @param path 저장 경로
+ * @return 성공하면 true
+ */
+bool game_load_from_file(game_state_t* game, const game_clock_t* clock, const char* path) {
+    if (!path) return false;
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    uint8_t buffer[SAVE_MAX_SIZE];
+    size_t size = fread(buffer, 1, sizeof(buffer), file);
+    fclose(file);
+
+    return game_load_from_buffer(game, clock, buffer, size);
+}
@@ -0,0 +1,39 @@
+/**
+ * @file save.h
+ * @brief 게임 상태를 비트 단위로 압축해 저장하고 복원
+ *
+ * game_state_t는 뱀 연결 리스트 포인터와 뮤텍스를 담고 있어 그대로 복사할 수
+ * 없으므로, 시뮬레이션에 필요한 값만 골라 작은 버전 있는 형식으로 씁니다.
+ *
+ * 형식: "SNKS" | 버전 u8 | 비트 스트림 (LSB 우선)
+ *   게임: 틱 32 | 난수 상태 32 | 시드 32 | 속도 16 | 사과 수 16 | 장애물 수 16 |
+ *         먹은 사과 32 | 플레이 시간(ms) 32 | 모드 2 | 상태 2 | 종료 1 | 승자+1 2 |
+ *         플레이어 수 4
+ *   뱀마다: 유형 2 | 방향 2 | 생존 1 | 점수 32 | 길이 11 | 머리 x 6 | 머리 y 6 |
+ *           이후 마디마다 앞 마디에서의 방향 2
+ *   맵: 칸마다 2비트 (빈칸/사과/장애물/뱀 - 머리와 몸통은 뱀 정보로 복원)
+ */
+
+#ifndef SAVE_H
+#define SAVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "game.h"
+
+#define SAVE_MAGIC "SNKS"
+#define SAVE_VERSION 1
+#define SAVE_DIRECTORY "saves"                 // 기본 저장 위치
+#define SAVE_RESUME_PATH "saves/resume.snks"   // 중단한 게임 이어하기 파일
+
+// 저장 데이터 최대 크기 (바이트)
+#define SAVE_MAX_SIZE (5 + (256 + MAX_PLAYERS * (60 + MAX_SNAKE_LENGTH * 2) + \
+                            GAME_WIDTH * GAME_HEIGHT * 2) / 8 + 1)
+
+size_t game_save_to_buffer(const game_state_t* game, uint8_t* out, size_t capacity);
+bool game_load_from_buffer(game_state_t* game, const game_clock_t* clock, const uint8_t* data, size_t size);
+bool game_save_to_file(const game_state_t* game, const char* path);
+bool game_load_from_file(game_state_t* game, const game_clock_t* clock, const char* path);
+
+#endif // SAVE_H
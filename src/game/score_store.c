@@ -0,0 +1,618 @@
+#include "score_store.h"
+#include "../platform/platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SCORE_LOG_MAGIC "SNKL"
+#define SCORE_INDEX_MAGIC "SNKX"
+#define SCORE_STORE_VERSION 1
+#define SCORE_LOG_HEADER_SIZE 8
+#define SCORE_RECORD_SIZE 32
+#define SCORE_INDEX_HEADER_SIZE (12 + SCORE_STORE_MODES * 4)
+#define SCORE_INDEX_ENTRY_SIZE 8
+#define SCORE_SCAN_CHUNK 4096          // 로그를 따라잡을 때 한 번에 읽는 레코드 수
+#define SCORE_RECENT_MAX 4096          // 본 색인에 합치기 전까지 모아 두는 최근 항목 수
+
+/**
+ * @brief 색인 항목 - 점수와 로그 안의 레코드 번호
+ */
+typedef struct {
+    uint32_t score;
+    uint32_t record;
+} score_index_entry_t;
+
+/**
+ * @brief 한 모드의 정렬된 색인 (점수 내림차순, 같은 점수는 먼저 기록된 순)
+ *
+ * 커밋마다 큰 배열 전체를 옮기지 않도록 새 항목은 작은 최근 배열에 먼저
+ * 병합하고, 그 배열이 차면 한꺼번에 본 배열로 합칩니다. 조회는 두 배열을
+ * 함께 봅니다.
+ */
+typedef struct {
+    score_index_entry_t* entries;                  // 본 색인
+    size_t count;
+    size_t capacity;
+    score_index_entry_t recent[SCORE_RECENT_MAX];  // 아직 합치지 않은 최근 항목
+    size_t recent_count;
+} score_index_t;
+
+/**
+ * @brief 기록 저장소 내부 구조체
+ */
+struct score_store {
+    FILE* log;                                 // 경기 로그 (읽기/쓰기)
+    char log_path[512];                        // 로그 경로
+    char index_path[512];                      // 색인 경로
+    uint32_t record_count;                     // 로그에 커밋된 레코드 수
+    score_index_t index[SCORE_STORE_MODES];    // 모드별 색인
+    bool index_dirty;                          // 색인 파일이 로그보다 뒤처졌는지
+    uint8_t pending[SCORE_STORE_BATCH * SCORE_RECORD_SIZE];  // 커밋 대기 레코드
+    int pending_count;                         // 커밋 대기 레코드 수
+    score_index_entry_t scratch[SCORE_STORE_MODES][SCORE_SCAN_CHUNK];  // 묶음 정렬용
+};
+
+static void put_u16(uint8_t* out, uint16_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+}
+
+static void put_u32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+static uint16_t get_u16(const uint8_t* in) {
+    return (uint16_t)(in[0] | in[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t* in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+/**
+ * @brief 레코드 체크섬 (FNV-1a 32비트)
+ */
+static uint32_t record_checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void encode_record(uint8_t* out, const score_record_t* record) {
+    put_u32(out, record->score);
+    put_u32(out + 4, record->duration_ms);
+    put_u32(out + 8, (uint32_t)record->timestamp);
+    put_u32(out + 12, (uint32_t)(record->timestamp >> 32));
+    put_u32(out + 16, record->seed);
+    put_u16(out + 20, record->length);
+    put_u16(out + 22, record->apples);
+    out[24] = (uint8_t)record->mode;
+    out[25] = record->personality;
+    out[26] = (uint8_t)record->outcome;
+    out[27] = 0;
+    put_u32(out + 28, record_checksum(out, 28));
+}
+
+/**
+ * @brief 레코드를 해석합니다
+ * @return 체크섬과 모드가 올바르면 true (끊긴 쓰기는 false)
+ */
+static bool decode_record(const uint8_t* in, score_record_t* record) {
+    if (get_u32(in + 28) != record_checksum(in, 28) || in[24] >= SCORE_STORE_MODES) {
+        return false;
+    }
+
+    record->score = get_u32(in);
+    record->duration_ms = get_u32(in + 4);
+    record->timestamp = (uint64_t)get_u32(in + 8) | (uint64_t)get_u32(in + 12) << 32;
+    record->seed = get_u32(in + 16);
+    record->length = get_u16(in + 20);
+    record->apples = get_u16(in + 22);
+    record->mode = (game_mode_t)in[24];
+    record->personality = in[25];
+    record->outcome = (match_outcome_t)in[26];
+    return true;
+}
+
+/**
+ * @brief 색인 정렬 순서 (점수 내림차순, 같으면 레코드 번호 오름차순)
+ */
+static int compare_entries(const void* a, const void* b) {
+    const score_index_entry_t* x = (const score_index_entry_t*)a;
+    const score_index_entry_t* y = (const score_index_entry_t*)b;
+    if (x->score != y->score) return x->score > y->score ? -1 : 1;
+    if (x->record != y->record) return x->record < y->record ? -1 : 1;
+    return 0;
+}
+
+static bool reserve_index(score_index_t* index, size_t needed) {
+    if (needed <= index->capacity) return true;
+
+    size_t capacity = index->capacity ? index->capacity : 256;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+
+    score_index_entry_t* entries = realloc(index->entries, capacity * sizeof(score_index_entry_t));
+    if (!entries) return false;
+    index->entries = entries;
+    index->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief 정렬된 두 배열을 병합합니다
+ *
+ * entries 뒤에 added_count만큼 자리가 있어야 하며, 뒤에서부터 채우므로
+ * 추가 메모리 없이 O(count + added_count)에 끝납니다.
+ */
+static void merge_sorted(score_index_entry_t* entries, size_t count,
+                         const score_index_entry_t* added, size_t added_count) {
+    size_t old_pos = count;
+    size_t new_pos = added_count;
+    size_t out = count + added_count;
+    while (new_pos > 0) {
+        if (old_pos > 0 && compare_entries(&entries[old_pos - 1], &added[new_pos - 1]) > 0) {
+            entries[--out] = entries[--old_pos];
+        } else {
+            entries[--out] = added[--new_pos];
+        }
+    }
+}
+
+/**
+ * @brief 정렬된 항목들을 본 색인에 바로 병합합니다
+ */
+static bool merge_into_main(score_index_t* index, const score_index_entry_t* added, size_t count) {
+    if (count == 0) return true;
+    if (!reserve_index(index, index->count + count)) return false;
+
+    merge_sorted(index->entries, index->count, added, count);
+    index->count += count;
+    return true;
+}
+
+/**
+ * @brief 최근 항목을 본 색인에 합칩니다
+ */
+static bool flush_recent(score_index_t* index) {
+    if (!merge_into_main(index, index->recent, index->recent_count)) return false;
+    index->recent_count = 0;
+    return true;
+}
+
+/**
+ * @brief 정렬된 새 항목들을 색인에 추가합니다
+ */
+static bool add_sorted(score_index_t* index, const score_index_entry_t* added, size_t count) {
+    if (index->recent_count + count > SCORE_RECENT_MAX && !flush_recent(index)) {
+        return false;
+    }
+    if (count > SCORE_RECENT_MAX) {
+        return merge_into_main(index, added, count);
+    }
+
+    merge_sorted(index->recent, index->recent_count, added, count);
+    index->recent_count += count;
+    return true;
+}
+
+/**
+ * @brief 레코드 묶음을 모드별로 정렬해 색인에 반영합니다
+ *
+ * @param store 저장소
+ * @param data 인코딩된 레코드들
+ * @param count 레코드 수
+ * @param first_record 첫 레코드의 번호
+ * @return 올바른 레코드 수 (첫 손상 레코드 앞까지)
+ */
+static uint32_t index_records(score_store_t* store, const uint8_t* data, uint32_t count, uint32_t first_record) {
+    score_index_entry_t (*by_mode)[SCORE_SCAN_CHUNK] = store->scratch;
+    size_t mode_count[SCORE_STORE_MODES] = {0};
+
+    uint32_t valid = 0;
+    while (valid < count && valid < SCORE_SCAN_CHUNK) {
+        score_record_t record;
+        if (!decode_record(data + (size_t)valid * SCORE_RECORD_SIZE, &record)) break;
+
+        score_index_entry_t* entry = &by_mode[record.mode][mode_count[record.mode]++];
+        entry->score = record.score;
+        entry->record = first_record + valid;
+        valid++;
+    }
+
+    for (int mode = 0; mode < SCORE_STORE_MODES; mode++) {
+        qsort(by_mode[mode], mode_count[mode], sizeof(score_index_entry_t), compare_entries);
+        if (!add_sorted(&store->index[mode], by_mode[mode], mode_count[mode])) {
+            return 0;
+        }
+    }
+    return valid;
+}
+
+/**
+ * @brief 색인 파일을 읽습니다
+ * @return 로그에 맞는 색인을 읽었으면 true (아니면 색인은 비어 있음)
+ */
+static bool load_index(score_store_t* store, uint32_t log_records) {
+    FILE* file = fopen(store->index_path, "rb");
+    if (!file) return false;
+
+    uint8_t header[SCORE_INDEX_HEADER_SIZE];
+    bool ok = fread(header, 1, sizeof(header), file) == sizeof(header) &&
+              memcmp(header, SCORE_INDEX_MAGIC, 4) == 0 &&
+              get_u32(header + 4) == SCORE_STORE_VERSION &&
+              get_u32(header + 8) <= log_records;
+
+    uint32_t covered = ok ? get_u32(header + 8) : 0;
+    size_t total = 0;
+    for (int mode = 0; ok && mode < SCORE_STORE_MODES; mode++) {
+        size_t count = get_u32(header + 12 + mode * 4);
+        total += count;
+        ok = total <= covered && reserve_index(&store->index[mode], count);
+        if (!ok) break;
+
+        // 항목 형식이 구조체 배치와 같으므로 읽은 뒤 엔디언만 맞춤
+        score_index_t* index = &store->index[mode];
+        ok = fread(index->entries, SCORE_INDEX_ENTRY_SIZE, count, file) == count;
+        for (size_t i = 0; ok && i < count; i++) {
+            const uint8_t* raw = (const uint8_t*)&index->entries[i];
+            index->entries[i].score = get_u32(raw);
+            index->entries[i].record = get_u32(raw + 4);
+        }
+        index->count = ok ? count : 0;
+    }
+    fclose(file);
+
+    if (!ok || total != covered) {
+        for (int mode = 0; mode < SCORE_STORE_MODES; mode++) {
+            store->index[mode].count = 0;
+        }
+        return false;
+    }
+    store->record_count = covered;
+    return true;
+}
+
+/**
+ * @brief 색인을 파일로 씁니다 (임시 파일에 쓴 뒤 이름 바꾸기)
+ */
+static bool save_index(score_store_t* store) {
+    for (int mode = 0; mode < SCORE_STORE_MODES; mode++) {
+        if (!flush_recent(&store->index[mode])) return false;
+    }
+
+    char temp_path[520];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", store->index_path);
+
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) return false;
+
+    uint8_t header[SCORE_INDEX_HEADER_SIZE];
+    memcpy(header, SCORE_INDEX_MAGIC, 4);
+    put_u32(header + 4, SCORE_STORE_VERSION);
+    put_u32(header + 8, store->record_count);
+    for (int mode = 0; mode < SCORE_STORE_MODES; mode++) {
+        put_u32(header + 12 + mode * 4, (uint32_t)store->index[mode].count);
+    }
+    bool ok = fwrite(header, 1, sizeof(header), file) == sizeof(header);
+
+    uint8_t chunk[SCORE_SCAN_CHUNK * SCORE_INDEX_ENTRY_SIZE];
+    for (int mode = 0; ok && mode < SCORE_STORE_MODES; mode++) {
+        const score_index_t* index = &store->index[mode];
+        for (size_t start = 0; ok && start < index->count; start += SCORE_SCAN_CHUNK) {
+            size_t count = index->count - start < SCORE_SCAN_CHUNK ? index->count - start : SCORE_SCAN_CHUNK;
+            for (size_t i = 0; i < count; i++) {
+                put_u32(chunk + i * SCORE_INDEX_ENTRY_SIZE, index->entries[start + i].score);
+                put_u32(chunk + i * SCORE_INDEX_ENTRY_SIZE + 4, index->entries[start + i].record);
+            }
+            ok = fwrite(chunk, SCORE_INDEX_ENTRY_SIZE, count, file) == count;
+        }
+    }
+    ok = fclose(file) == 0 && ok;
+
+    if (ok) {
+        remove(store->index_path);
+        ok = rename(temp_path, store->index_path) == 0;
+    }
+    if (!ok) remove(temp_path);
+    return ok;
+}
+
+/**
+ * @brief 색인에 없는 로그 뒷부분을 읽어 색인을 따라잡습니다
+ *
+ * 손상된 레코드를 만나면 거기서 멈추고, 그 자리부터 다음 커밋이 덮어씁니다.
+ */
+static bool catch_up_index(score_store_t* store) {
+    if (fseek(store->log, SCORE_LOG_HEADER_SIZE + (long)store->record_count * SCORE_RECORD_SIZE, SEEK_SET) != 0) {
+        return false;
+    }
+
+    uint8_t* chunk = malloc((size_t)SCORE_SCAN_CHUNK * SCORE_RECORD_SIZE);
+    if (!chunk) return false;
+
+    for (;;) {
+        size_t read = fread(chunk, SCORE_RECORD_SIZE, SCORE_SCAN_CHUNK, store->log);
+        if (read == 0) break;
+
+        uint32_t valid = index_records(store, chunk, (uint32_t)read, store->record_count);
+        store->record_count += valid;
+        if (valid > 0) store->index_dirty = true;
+        if (valid < read || read < SCORE_SCAN_CHUNK) break;
+    }
+    free(chunk);
+    return true;
+}
+
+/**
+ * @brief 기록 저장소를 엽니다 (없으면 새로 만듦)
+ *
+ * @param directory 로그와 색인을 둘 디렉터리
+ * @return 저장소, 파일을 열 수 없으면 NULL
+ */
+score_store_t* score_store_open(const char* directory) {
+    if (!directory || !platform_create_directory(directory)) return NULL;
+
+    score_store_t* store = calloc(1, sizeof(score_store_t));
+    if (!store) return NULL;
+
+    snprintf(store->log_path, sizeof(store->log_path), "%s/matches.log", directory);
+    snprintf(store->index_path, sizeof(store->index_path), "%s/index.dat", directory);
+
+    // 쓰기 위치를 직접 정해야 끊긴 레코드를 덮어쓸 수 있으므로 추가 모드는 쓰지 않음
+    store->log = fopen(store->log_path, "r+b");
+    if (!store->log) {
+        store->log = fopen(store->log_path, "w+b");
+        uint8_t header[SCORE_LOG_HEADER_SIZE];
+        memcpy(header, SCORE_LOG_MAGIC, 4);
+        put_u32(header + 4, SCORE_STORE_VERSION);
+        if (!store->log || fwrite(header, 1, sizeof(header), store->log) != sizeof(header) ||
+            fflush(store->log) != 0) {
+            score_store_close(store);
+            return NULL;
+        }
+    } else {
+        uint8_t header[SCORE_LOG_HEADER_SIZE];
+        if (fread(header, 1, sizeof(header), store->log) != sizeof(header) ||
+            memcmp(header, SCORE_LOG_MAGIC, 4) != 0 || get_u32(header + 4) != SCORE_STORE_VERSION) {
+            score_store_close(store);
+            return NULL;
+        }
+    }
+
+    // 로그에 들어 있는 레코드 수 (색인이 이보다 많이 안다고 하면 버림)
+    fseek(store->log, 0, SEEK_END);
+    long log_size = ftell(store->log);
+    uint32_t log_records = log_size > SCORE_LOG_HEADER_SIZE ?
+        (uint32_t)((log_size - SCORE_LOG_HEADER_SIZE) / SCORE_RECORD_SIZE) : 0;
+
+    if (!load_index(store, log_records)) {
+        store->record_count = 0;
+    }
+    if (!catch_up_index(store)) {
+        score_store_close(store);
+        return NULL;
+    }
+    return store;
+}
+
+/**
+ * @brief 남은 레코드를 커밋하고 색인을 저장한 뒤 저장소를 닫습니다
+ *
+ * @param store 저장소
+ * @return 모두 문제없이 썼으면 true
+ */
+bool score_store_close(score_store_t* store) {
+    if (!store) return false;
+
+    bool ok = true;
+    if (store->log) {
+        ok = score_store_commit(store);
+        if (store->index_dirty) {
+            ok = save_index(store) && ok;
+        }
+        ok = fclose(store->log) == 0 && ok;
+    }
+
+    for (int mode = 0; mode < SCORE_STORE_MODES; mode++) {
+        free(store->index[mode].entries);
+    }
+    free(store);
+    return ok;
+}
+
+/**
+ * @brief 레코드를 커밋 대기열에 추가합니다
+ *
+ * 대기열이 SCORE_STORE_BATCH개가 되면 자동으로 커밋하므로, 여러 경기를 한꺼번에
+ * 넣을 때(예: 리플레이 가져오기) 파일 쓰기와 색인 병합이 묶음 단위로 일어납니다.
+ *
+ * @param store 저장소
+ * @param record 추가할 레코드
+ * @return 성공하면 true
+ */
+bool score_store_append(score_store_t* store, const score_record_t* record) {
+    if (!store || !record || (int)record->mode < 0 || record->mode >= SCORE_STORE_MODES) return false;
+
+    // 이전 자동 커밋이 실패해 대기열이 가득 차 있으면 먼저 비움
+    if (store->pending_count == SCORE_STORE_BATCH && !score_store_commit(store)) {
+        return false;
+    }
+
+    encode_record(store->pending + (size_t)store->pending_count * SCORE_RECORD_SIZE, record);
+    store->pending_count++;
+
+    if (store->pending_count == SCORE_STORE_BATCH) {
+        return score_store_commit(store);
+    }
+    return true;
+}
+
+/**
+ * @brief 대기 중인 레코드를 한 번의 쓰기로 로그에 남기고 색인에 반영합니다
+ *
+ * @param store 저장소
+ * @return 성공하면 true (실패하면 대기열은 그대로 남음)
+ */
+bool score_store_commit(score_store_t* store) {
+    if (!store) return false;
+    if (store->pending_count == 0) return true;
+
+    size_t size = (size_t)store->pending_count * SCORE_RECORD_SIZE;
+    long offset = SCORE_LOG_HEADER_SIZE + (long)store->record_count * SCORE_RECORD_SIZE;
+    if (fseek(store->log, offset, SEEK_SET) != 0 ||
+        fwrite(store->pending, 1, size, store->log) != size ||
+        fflush(store->log) != 0) {
+        return false;
+    }
+
+    uint32_t indexed = index_records(store, store->pending, (uint32_t)store->pending_count, store->record_count);
+    store->record_count += indexed;
+    store->pending_count = 0;
+    store->index_dirty = true;
+    return indexed > 0;
+}
+
+/**
+ * @brief 모드의 커밋된 경기 수를 가져옵니다
+ */
+size_t score_store_count(const score_store_t* store, game_mode_t mode) {
+    if (!store || (int)mode < 0 || mode >= SCORE_STORE_MODES) return 0;
+    return store->index[mode].count + store->index[mode].recent_count;
+}
+
+/**
+ * @brief 정렬된 배열에서 점수가 더 높은 항목 수를 셉니다 (이진 탐색)
+ */
+static size_t count_higher(const score_index_entry_t* entries, size_t count, uint32_t score) {
+    // 내림차순 배열에서 score 이하가 처음 나오는 위치
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (entries[mid].score > score) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief 점수가 모드 안에서 몇 위인지 구합니다 (이진 탐색)
+ *
+ * @param store 저장소
+ * @param mode 게임 모드
+ * @param score 점수
+ * @return 순위 (1부터, 같은 점수는 같은 순위)
+ */
+int score_store_rank(const score_store_t* store, game_mode_t mode, uint32_t score) {
+    if (!store || (int)mode < 0 || mode >= SCORE_STORE_MODES) return 0;
+
+    const score_index_t* index = &store->index[mode];
+    return (int)(count_higher(index->entries, index->count, score) +
+                 count_higher(index->recent, index->recent_count, score)) + 1;
+}
+
+/**
+ * @brief 모드의 상위 k개 기록을 가져옵니다
+ *
+ * 색인 앞부분에서 레코드 번호를 얻어 로그에서 k개만 읽으므로 전체
+ * 기록 수와 관계없이 빠릅니다.
+ *
+ * @param store 저장소
+ * @param mode 게임 모드
+ * @param k 가져올 최대 개수
+ * @param out 결과 배열 (k개 이상)
+ * @return 가져온 개수
+ */
+size_t score_store_top(score_store_t* store, game_mode_t mode, size_t k, score_record_t* out) {
+    if (!store || !out || (int)mode < 0 || mode >= SCORE_STORE_MODES) return 0;
+
+    // 본 색인과 최근 항목의 앞부분을 병합하며 k개 선택
+    const score_index_t* index = &store->index[mode];
+    size_t main_pos = 0;
+    size_t recent_pos = 0;
+    size_t count = 0;
+    while (count < k && (main_pos < index->count || recent_pos < index->recent_count)) {
+        const score_index_entry_t* entry;
+        if (recent_pos >= index->recent_count ||
+            (main_pos < index->count &&
+             compare_entries(&index->entries[main_pos], &index->recent[recent_pos]) < 0)) {
+            entry = &index->entries[main_pos++];
+        } else {
+            entry = &index->recent[recent_pos++];
+        }
+
+        uint8_t data[SCORE_RECORD_SIZE];
+        long offset = SCORE_LOG_HEADER_SIZE + (long)entry->record * SCORE_RECORD_SIZE;
+        if (fseek(store->log, offset, SEEK_SET) != 0 ||
+            fread(data, 1, sizeof(data), store->log) != sizeof(data) ||
+            !decode_record(data, &out[count])) {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief 끝난 게임에서 사용자 플레이어의 경기 기록을 만듭니다
+ *
+ * @param record 채울 레코드
+ * @param game 끝난 게임 상태
+ * @param ai_personality AI 특성 (싱글 플레이면 무시)
+ */
+void score_record_from_game(score_record_t* record, const game_state_t* game, int ai_personality) {
+    const snake_t* player = &game->players[0];
+
+    memset(record, 0, sizeof(*record));
+    record->score = (uint32_t)player->score;
+    record->duration_ms = (uint32_t)game_get_play_time((game_state_t*)game);
+    record->timestamp = (uint64_t)time(NULL);
+    record->seed = game->seed;
+    record->length = (uint16_t)player->length;
+    record->apples = (uint16_t)game->apples_eaten;
+    record->mode = game->mode;
+
+    if (game->mode == GAME_MODE_SINGLE) {
+        record->outcome = MATCH_OUTCOME_SOLO;
+    } else {
+        record->personality = (uint8_t)ai_personality;
+        if (game->winner_id < 0) {
+            record->outcome = MATCH_OUTCOME_DRAW;
+        } else {
+            record->outcome = game->winner_id == 0 ? MATCH_OUTCOME_WIN : MATCH_OUTCOME_LOSS;
+        }
+    }
+}
+
+/**
+ * @brief 경기 하나를 바로 커밋하고 그 경기의 개인 순위를 구합니다
+ *
+ * @param store 저장소 (NULL이면 순위 정보 없음)
+ * @param record 경기 기록
+ * @return 같은 모드 안에서의 순위
+ */
+score_ranking_t score_store_record_match(score_store_t* store, const score_record_t* record) {
+    score_ranking_t ranking = {0, 0, 0};
+    if (!store || !record) return ranking;
+    if (!score_store_append(store, record) || !score_store_commit(store)) return ranking;
+
+    const score_index_t* index = &store->index[record->mode];
+    ranking.rank = score_store_rank(store, record->mode, record->score);
+    ranking.total = (int)score_store_count(store, record->mode);
+    if (index->count > 0) {
+        ranking.best_score = index->entries[0].score;
+    }
+    if (index->recent_count > 0 && index->recent[0].score > ranking.best_score) {
+        ranking.best_score = index->recent[0].score;
+    }
+    return ranking;
+}
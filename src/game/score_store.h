@@ -0,0 +1,85 @@
+/**
+ * @file score_store.h
+ * @brief 경기 결과를 디스크에 남기는 기록 저장소와 모드별 순위 색인
+ *
+ * 경기 결과는 추가만 하는 로그(matches.log)에 고정 크기 레코드로 쌓이고,
+ * 모드별로 점수 내림차순 정렬된 작은 색인(index.dat)이 순위 조회를 맡습니다.
+ * 로그가 원본이고 색인은 캐시라서, 색인이 없거나 뒤처져 있으면 열 때
+ * 로그의 나머지 부분만 읽어 따라잡습니다.
+ *
+ * 로그 형식 (리틀 엔디언):
+ *   헤더 8바이트: "SNKL" | 버전 u32
+ *   레코드 32바이트: 점수 u32 | 플레이 시간(ms) u32 | 시각(초) u64 | 시드 u32 |
+ *                   길이 u16 | 먹은 사과 u16 | 모드 u8 | AI 특성 u8 | 결과 u8 |
+ *                   예약 u8 | 체크섬 u32 (앞 28바이트의 FNV-1a)
+ *   쓰다가 끊긴 마지막 레코드는 체크섬으로 걸러내고 다음 쓰기가 덮어씁니다.
+ *
+ * 색인 형식: "SNKX" | 버전 u32 | 반영한 레코드 수 u32 | 모드별 항목 수 u32 x 4 |
+ *            모드 순서대로 (점수 u32 | 레코드 번호 u32) 항목들
+ */
+
+#ifndef SCORE_STORE_H
+#define SCORE_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "game.h"
+
+#define SCORE_STORE_DIRECTORY "scores" // 기본 저장 위치
+#define SCORE_STORE_BATCH 64           // 한 번에 커밋하는 최대 레코드 수
+#define SCORE_STORE_MODES 4            // 게임 모드 수 (game_mode_t)
+
+/**
+ * @brief 경기 결과 (사용자 플레이어 기준)
+ */
+typedef enum {
+    MATCH_OUTCOME_SOLO,            // 싱글 플레이 (승패 없음)
+    MATCH_OUTCOME_WIN,             // AI 대전 승리
+    MATCH_OUTCOME_LOSS,            // AI 대전 패배
+    MATCH_OUTCOME_DRAW             // 모두 동시에 탈락
+} match_outcome_t;
+
+/**
+ * @brief 경기 하나의 기록
+ */
+typedef struct {
+    uint32_t score;                // 사용자 점수
+    uint32_t duration_ms;          // 플레이 시간 (일시정지 제외)
+    uint64_t timestamp;            // 경기가 끝난 시각 (유닉스 시간, 초)
+    uint32_t seed;                 // 게임 난수 시드 (리플레이와 연결)
+    uint16_t length;               // 사용자 뱀 길이
+    uint16_t apples;               // 경기에서 먹힌 사과 수
+    game_mode_t mode;              // 게임 모드
+    uint8_t personality;           // AI 특성 (ui.h의 ai_personality)
+    match_outcome_t outcome;       // 경기 결과
+} score_record_t;
+
+/**
+ * @brief 방금 기록한 경기의 개인 순위
+ */
+typedef struct {
+    int rank;                      // 같은 모드에서의 순위 (1부터, 0이면 정보 없음)
+    int total;                     // 같은 모드의 전체 경기 수
+    uint32_t best_score;           // 같은 모드의 최고 점수
+} score_ranking_t;
+
+/**
+ * @brief 기록 저장소 (불투명 타입)
+ */
+typedef struct score_store score_store_t;
+
+score_store_t* score_store_open(const char* directory);
+bool score_store_close(score_store_t* store);
+bool score_store_append(score_store_t* store, const score_record_t* record);
+bool score_store_commit(score_store_t* store);
+
+// 조회 (커밋된 레코드만 반영)
+size_t score_store_count(const score_store_t* store, game_mode_t mode);
+int score_store_rank(const score_store_t* store, game_mode_t mode, uint32_t score);
+size_t score_store_top(score_store_t* store, game_mode_t mode, size_t k, score_record_t* out);
+
+void score_record_from_game(score_record_t* record, const game_state_t* game, int ai_personality);
+score_ranking_t score_store_record_match(score_store_t* store, const score_record_t* record);
+
+#endif // SCORE_STORE_H
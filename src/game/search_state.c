@@ -0,0 +1,162 @@
+#include "search_state.h"
+#include <string.h>
+
+/**
+ * @brief 게임 상태를 탐색 상태로 옮깁니다
+ *
+ * 맵 한 번과 뱀 노드 한 번씩만 훑으며, 이후의 가상 이동은 이 복사본에서만
+ * 일어나므로 게임 상태는 바뀌지 않습니다.
+ *
+ * @param search 채울 탐색 상태
+ * @param game 원본 게임 상태
+ */
+void search_state_from_game(search_state_t* search, const game_state_t* game) {
+    for (int y = 0; y < GAME_HEIGHT; y++) {
+        for (int x = 0; x < GAME_WIDTH; x++) {
+            uint8_t code = SEARCH_CELL_EMPTY;
+            switch (game->map[y][x]) {
+                case CELL_APPLE: code = SEARCH_CELL_APPLE; break;
+                case CELL_OBSTACLE: code = SEARCH_CELL_OBSTACLE; break;
+                case CELL_SNAKE_HEAD:
+                case CELL_SNAKE_BODY: code = SEARCH_CELL_SNAKE; break;
+                default: break;
+            }
+            search->cells[y * GAME_WIDTH + x] = code;
+        }
+    }
+
+    search->num_players = game->num_players;
+    search->undo_count = 0;
+    for (int i = 0; i < game->num_players; i++) {
+        const snake_t* snake = &game->players[i];
+        search_snake_t* target = &search->snakes[i];
+
+        target->head = 0;
+        target->length = 0;
+        for (const snake_node_t* node = snake->head; node; node = node->next) {
+            target->body[target->length++] = (uint16_t)(node->pos.y * GAME_WIDTH + node->pos.x);
+        }
+        target->direction = snake->direction;
+        target->alive = snake->alive;
+        target->score = snake->score;
+    }
+}
+
+/**
+ * @brief 뱀 하나를 한 칸 움직이고 실행 취소 기록을 남깁니다
+ *
+ * game_update처럼 역방향 입력은 무시하고 현재 방향으로 움직입니다.
+ * 죽는 이동도 기록되므로 true를 받았으면 반드시 search_unmake_move로
+ * 되돌려야 하며, 생존 여부는 snakes[player_id].alive로 확인합니다.
+ *
+ * @param search 탐색 상태
+ * @param player_id 움직일 뱀
+ * @param direction 이동 방향
+ * @return 이동을 기록했으면 true (이미 죽었거나 기록이 가득 차면 false)
+ */
+bool search_make_move(search_state_t* search, int player_id, direction_t direction) {
+    if (player_id < 0 || player_id >= search->num_players) return false;
+    if (search->undo_count >= SEARCH_MAX_DEPTH) return false;
+
+    search_snake_t* snake = &search->snakes[player_id];
+    if (!snake->alive) return false;
+
+    search_undo_t* undo = &search->undo[search->undo_count++];
+    undo->player_id = (uint8_t)player_id;
+    undo->flags = 0;
+    undo->previous_direction = (uint8_t)snake->direction;
+    undo->tail_cell = 0;
+
+    if (!is_opposite_direction(snake->direction, direction)) {
+        snake->direction = direction;
+    }
+
+    // 이동 전 맵 기준 충돌 판정 (비워질 꼬리 칸도 막힌 칸)
+    position_t next_pos = get_next_position(search_snake_head(search, player_id), snake->direction);
+    if (!search_is_free(search, next_pos)) {
+        undo->flags = SEARCH_UNDO_DIED;
+        snake->alive = false;
+        return true;
+    }
+
+    int next_cell = next_pos.y * GAME_WIDTH + next_pos.x;
+    if (search->cells[next_cell] == SEARCH_CELL_APPLE) {
+        undo->flags = SEARCH_UNDO_ATE;
+        snake->score += 100;  // 사과 점수
+    }
+
+    // 머리 추가: 원형 버퍼에서 한 칸 앞으로
+    snake->head = snake->head > 0 ? snake->head - 1 : MAX_SNAKE_LENGTH - 1;
+    snake->body[snake->head] = (uint16_t)next_cell;
+    search->cells[next_cell] = SEARCH_CELL_SNAKE;
+    snake->length++;
+    snake->score++;  // 이동 점수
+
+    // 성장하지 않으면 꼬리 제거 (버퍼에는 값이 남아 되돌릴 때 그대로 씀)
+    if (!(undo->flags & SEARCH_UNDO_ATE)) {
+        int tail = (snake->head + snake->length - 1) % MAX_SNAKE_LENGTH;
+        undo->tail_cell = snake->body[tail];
+        search->cells[undo->tail_cell] = SEARCH_CELL_EMPTY;
+        snake->length--;
+    }
+    return true;
+}
+
+/**
+ * @brief 가장 최근의 search_make_move를 되돌립니다
+ *
+ * @param search 탐색 상태
+ */
+void search_unmake_move(search_state_t* search) {
+    if (search->undo_count <= 0) return;
+
+    const search_undo_t* undo = &search->undo[--search->undo_count];
+    search_snake_t* snake = &search->snakes[undo->player_id];
+    snake->direction = (direction_t)undo->previous_direction;
+
+    if (undo->flags & SEARCH_UNDO_DIED) {
+        snake->alive = true;
+        return;
+    }
+
+    // 꼬리 복원 (버퍼의 꼬리 다음 자리에 값이 그대로 남아 있음)
+    if (!(undo->flags & SEARCH_UNDO_ATE)) {
+        search->cells[undo->tail_cell] = SEARCH_CELL_SNAKE;
+        snake->length++;
+    }
+
+    // 머리 제거 - 먹은 사과도 되살림
+    int head_cell = snake->body[snake->head];
+    search->cells[head_cell] = (undo->flags & SEARCH_UNDO_ATE) ? SEARCH_CELL_APPLE : SEARCH_CELL_EMPTY;
+    snake->head = snake->head < MAX_SNAKE_LENGTH - 1 ? snake->head + 1 : 0;
+    snake->length--;
+
+    snake->score -= (undo->flags & SEARCH_UNDO_ATE) ? 101 : 1;
+}
+
+/**
+ * @brief 뱀 머리 위치를 가져옵니다
+ *
+ * @param search 탐색 상태
+ * @param player_id 플레이어 인덱스
+ * @return 머리 위치
+ */
+position_t search_snake_head(const search_state_t* search, int player_id) {
+    const search_snake_t* snake = &search->snakes[player_id];
+    int cell = snake->body[snake->head];
+    return (position_t){cell % GAME_WIDTH, cell / GAME_WIDTH};
+}
+
+/**
+ * @brief 머리가 들어가도 죽지 않는 칸인지 확인합니다 (빈칸 또는 사과)
+ *
+ * @param search 탐색 상태
+ * @param pos 확인할 위치
+ * @return 들어갈 수 있으면 true
+ */
+bool search_is_free(const search_state_t* search, position_t pos) {
+    if (!is_valid_position(pos)) return false;
+
+    uint8_t cell = search->cells[pos.y * GAME_WIDTH + pos.x];
+    return cell == SEARCH_CELL_EMPTY || cell == SEARCH_CELL_APPLE;
+}
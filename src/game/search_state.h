@@ -0,0 +1,74 @@
+/**
+ * @file search_state.h
+ * @brief AI 미리보기용 포인터 없는 게임 상태와 make/unmake 이동
+ *
+ * game_state_t의 뱀은 malloc한 노드의 연결 리스트라 복사하거나 가상으로
+ * 움직여 보기에 비쌉니다. 탐색 상태는 맵을 칸 코드 배열로, 뱀을 칸 번호의
+ * 원형 버퍼로 담아 한 번에 복사할 수 있고, 이동은 실행 취소 기록을 남겨
+ * O(1)로 적용하고 되돌립니다 (할당 없음).
+ *
+ * 이동 규칙은 game_update와 같습니다: 이동 전 맵 기준으로 벽, 장애물,
+ * 뱀 칸(이번에 비워질 꼬리 포함)에 들어가면 죽고, 사과를 먹으면 꼬리를
+ * 남겨 길어집니다. 단, 뱀 하나씩 움직이므로 머리끼리 같은 칸에 들어가는
+ * 동시 충돌과 사과 재배치(난수)는 다루지 않습니다.
+ */
+
+#ifndef SEARCH_STATE_H
+#define SEARCH_STATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "game.h"
+
+#define SEARCH_MAX_DEPTH 64        // 되돌릴 수 있는 최대 이동 수 (실행 취소 기록 크기)
+
+// 탐색 맵의 칸 코드
+#define SEARCH_CELL_EMPTY 0
+#define SEARCH_CELL_APPLE 1
+#define SEARCH_CELL_OBSTACLE 2
+#define SEARCH_CELL_SNAKE 3        // 살아 있거나 죽은 뱀의 몸 (머리 포함)
+
+// 실행 취소 기록 플래그
+#define SEARCH_UNDO_DIED 0x01      // 이 이동으로 죽음
+#define SEARCH_UNDO_ATE 0x02       // 사과를 먹어 꼬리를 남김
+
+/**
+ * @brief 탐색용 뱀 (칸 번호 원형 버퍼)
+ */
+typedef struct {
+    uint16_t body[MAX_SNAKE_LENGTH];   // 칸 번호 (y * GAME_WIDTH + x), body[head]가 머리
+    int head;                          // 머리의 버퍼 위치 (이동할 때마다 하나씩 앞으로)
+    int length;                        // 뱀의 길이
+    direction_t direction;             // 현재 이동 방향
+    bool alive;                        // 생존 여부
+    int score;                         // 점수
+} search_snake_t;
+
+/**
+ * @brief 이동 하나를 되돌리는 데 필요한 정보
+ */
+typedef struct {
+    uint8_t player_id;             // 움직인 뱀
+    uint8_t flags;                 // SEARCH_UNDO_*
+    uint8_t previous_direction;    // 이동 전 방향
+    uint16_t tail_cell;            // 비운 꼬리 칸 (먹었거나 죽었으면 사용 안 함)
+} search_undo_t;
+
+/**
+ * @brief 복사와 가상 이동이 싼 평탄한 게임 상태
+ */
+typedef struct {
+    uint8_t cells[GAME_WIDTH * GAME_HEIGHT];   // 칸 코드 (SEARCH_CELL_*)
+    search_snake_t snakes[MAX_PLAYERS];        // 플레이어별 뱀
+    int num_players;                           // 플레이어 수
+    search_undo_t undo[SEARCH_MAX_DEPTH];      // 실행 취소 기록 (스택)
+    int undo_count;                            // 기록된 이동 수
+} search_state_t;
+
+void search_state_from_game(search_state_t* search, const game_state_t* game);
+bool search_make_move(search_state_t* search, int player_id, direction_t direction);
+void search_unmake_move(search_state_t* search);
+position_t search_snake_head(const search_state_t* search, int player_id);
+bool search_is_free(const search_state_t* search, position_t pos);
+
+#endif // SEARCH_STATE_H
@@ -1,8 +1,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include "platform/platform.h"
+#include "platform/capture.h"
 #include "game/game.h"
+#include "game/replay.h"
+#include "game/save.h"
+#include "game/score_store.h"
 #include "ui/ui.h"
 
 #ifdef PLATFORM_WEB
@@ -25,12 +30,143 @@ typedef struct {
     ui_context_t ui;                    // UI 컨텍스트
     bool running;                       // 애플리케이션 실행 중 여부
     bool in_game;                       // 게임 플레이 중 여부
-    uint64_t last_update_time;          // 마지막 게임 업데이트 시간
-    uint64_t last_ai_update_time;       // 마지막 AI 업데이트 시간
+    uint64_t next_tick_time;            // 다음 게임 틱 예정 시각 (마이크로초, 단조 시계)
+    uint64_t next_ai_update_time;       // 다음 AI 업데이트 예정 시각 (마이크로초)
+    int game_cpu;                       // 게임 스레드를 고정할 CPU (-1이면 고정 안 함)
+    thread_priority_t game_priority;    // 게임 스레드 우선순위
+    bool affinity_applied;              // CPU 고정 성공 여부 (게임 스레드가 기록)
+    bool priority_applied;              // 우선순위 변경 성공 여부 (게임 스레드가 기록)
+    tick_stats_t session_stats;         // 실행 중 모든 게임의 틱 통계 합계
+    score_store_t* scores;              // 경기 기록 저장소 (열지 못했으면 NULL)
 } app_state_t;
 
 static app_state_t g_app;
 
+// 시뮬레이션 스케줄링 상수
+#define AI_UPDATE_INTERVAL_US 100000    // AI 업데이트 간격 (100ms)
+#define MAX_CATCHUP_TICKS 4             // 한 번에 따라잡을 최대 틱 수 (넘으면 일정 재설정)
+
+/**
+ * @brief 예정 시각이 지난 AI 업데이트와 게임 틱을 고정 간격으로 실행합니다
+ * 
+ * 다음 예정 시각은 실제 실행 시각이 아니라 이전 예정 시각에 간격을 더해
+ * 정하므로, 깨어나는 지연이 누적되어 게임 속도가 느려지지 않습니다.
+ * 너무 많이 밀린 경우(일시 중단 등)에는 따라잡지 않고 일정을 다시 잡습니다.
+ * 
+ * @param app 애플리케이션 상태
+ * @param now_us 현재 시각 (마이크로초)
+ * @return 게임이 계속되면 true, 게임 오버면 false
+ */
+static bool run_due_updates(app_state_t* app, uint64_t now_us) {
+    // AI 플레이어 업데이트
+    if (now_us >= app->next_ai_update_time) {
+        ai_update_players(&app->game, app->ui.ai_personality);
+        app->next_ai_update_time += AI_UPDATE_INTERVAL_US;
+        if (now_us >= app->next_ai_update_time) {
+            app->next_ai_update_time = now_us + AI_UPDATE_INTERVAL_US;
+        }
+    }
+    
+    // 게임 틱 - 예정 시각이 지난 만큼 실행
+    for (int i = 0; i < MAX_CATCHUP_TICKS && now_us >= app->next_tick_time; i++) {
+        game_record_tick_jitter(&app->game, now_us - app->next_tick_time);
+        
+        if (!game_update(&app->game)) {
+            return false;
+        }
+        app->next_tick_time += (uint64_t)app->game.game_speed * 1000;
+    }
+    if (now_us >= app->next_tick_time) {
+        app->next_tick_time = now_us + (uint64_t)app->game.game_speed * 1000;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief 현재 게임의 리플레이 기록을 마칩니다
+ * 
+ * 시뮬레이션이 멈춘 뒤(네이티브는 게임 스레드 종료 후)에 호출합니다.
+ * 
+ * @param app 애플리케이션 상태
+ */
+static void finish_recording(app_state_t* app) {
+    if (!app->game.recorder) return;
+    
+    replay_recorder_finish(app->game.recorder, &app->game);
+    app->game.recorder = NULL;
+}
+
+/**
+ * @brief 끝난 경기를 기록 저장소에 남기고 결과 화면을 띄웁니다
+ * 
+ * 시뮬레이션이 멈춘 뒤에 호출하므로 게임 상태를 잠금 없이 읽습니다.
+ * 
+ * @param app 애플리케이션 상태
+ */
+static void show_game_over(app_state_t* app) {
+    score_record_t record;
+    score_record_from_game(&record, &app->game, app->ui.ai_personality);
+    score_ranking_t ranking = score_store_record_match(app->scores, &record);
+    
+    ui_set_state(&app->ui, UI_STATE_GAME_OVER);
+    ui_show_game_over(&app->ui, &app->game, &ranking);
+}
+
+/**
+ * @brief 이어하기 파일이 있는지 확인합니다
+ */
+static bool resume_file_exists(void) {
+    FILE* file = fopen(SAVE_RESUME_PATH, "rb");
+    if (!file) return false;
+    fclose(file);
+    return true;
+}
+
+/**
+ * @brief 끝나지 않은 게임을 이어하기 파일로 저장합니다
+ * 
+ * ESC로 게임을 떠날 때 시뮬레이션이 멈춘 뒤 호출합니다.
+ * 
+ * @param app 애플리케이션 상태
+ */
+static void save_unfinished_game(app_state_t* app) {
+    if (app->game.game_over) return;
+    
+    if (platform_create_directory(SAVE_DIRECTORY) &&
+        game_save_to_file(&app->game, SAVE_RESUME_PATH)) {
+        ui_set_saved_game_available(&app->ui, true);
+    }
+}
+
+/**
+ * @brief 이어하기 파일에서 게임을 불러옵니다
+ * 
+ * 불러온 파일은 지우고, 바로 움직이지 않도록 일시정지 상태로 시작합니다.
+ * 
+ * @param app 애플리케이션 상태
+ * @return 성공하면 true
+ */
+static bool load_saved_game(app_state_t* app) {
+    game_clock_t clock;
+    game_clock_init(&clock, GAME_CLOCK_REAL);
+    
+    bool loaded = game_load_from_file(&app->game, &clock, SAVE_RESUME_PATH);
+    remove(SAVE_RESUME_PATH);
+    ui_set_saved_game_available(&app->ui, false);
+    if (!loaded) {
+        game_cleanup(&app->game);
+        return false;
+    }
+    
+    // 게임 오버 후 다시 플레이하면 같은 모드로 시작
+    app->ui.selected_mode = app->game.mode;
+    if (app->game.state == GAME_STATE_PLAYING) {
+        game_toggle_pause(&app->game);
+    }
+    return true;
+}
+
 #ifdef PLATFORM_WEB
 /**
  * @brief 웹용 메인 루프 함수 (Emscripten 콜백)
@@ -70,23 +206,22 @@ void web_main_loop(void) {
                 }
                 
                 // 종료 확인
-                if (g_app.ui.current_state == UI_STATE_MAIN_MENU && 
-                    g_app.ui.selected_option == 3 && key == KEY_ENTER) {
+                if (g_app.ui.exit_requested) {
                     printf("사용자가 종료를 선택했습니다.\n");
                     g_app.running = false;
                 }
             }
         }
     } else {
-        // 게임 루프 처리
-        uint64_t current_time = platform_get_time_ms();
-        
+        // 게임 루프 처리 (게임 시계 기준)
         game_key_t key = platform_get_key_pressed();
         
         // ESC 키로 게임 종료
         if (key == KEY_ESC) {
             printf("게임에서 메뉴로 복귀\n");
             g_app.in_game = false;
+            finish_recording(&g_app);
+            save_unfinished_game(&g_app);
             ui_set_state(&g_app.ui, UI_STATE_MAIN_MENU);
             platform_clear_screen();
             return;
@@ -97,35 +232,106 @@ void web_main_loop(void) {
             game_handle_input(&g_app.game, 0, key);
         }
         
-        // AI 플레이어 업데이트 - 100ms마다
-        if (current_time - g_app.last_ai_update_time >= 100) {
-            ai_update_players(&g_app.game, g_app.ui.ai_personality);
-            g_app.last_ai_update_time = current_time;
+        // 예정 시각이 된 AI 업데이트와 게임 틱 실행
+        if (!run_due_updates(&g_app, game_clock_now_us(&g_app.game.clock))) {
+            printf("게임 오버\n");
+            g_app.in_game = false;
+            finish_recording(&g_app);
+            platform_clear_screen();
+            show_game_over(&g_app);
+            return;
         }
         
-        // 게임 상태 업데이트 - 게임 속도에 따라
-        if (current_time - g_app.last_update_time >= (uint64_t)g_app.game.game_speed) {
-            if (!game_update(&g_app.game)) {
-                printf("게임 오버\n");
-                g_app.in_game = false;
-                platform_clear_screen();
-                ui_set_state(&g_app.ui, UI_STATE_GAME_OVER);
-                ui_show_game_over(&g_app.ui, &g_app.game);
-                return;
-            }
-            g_app.last_update_time = current_time;
+        // 최신 스냅샷으로 보간 위치 갱신 후 렌더링
+        // (시계는 스냅샷을 얻은 뒤에 읽어야 방금 실행한 틱의 tick_time보다 앞서지 않음)
+        game_snapshot_t* snapshot = game_acquire_snapshot(&g_app.game);
+        game_update_smooth_motion(snapshot, game_clock_now_ms(&g_app.game.clock));
+        game_render(snapshot);
+    }
+}
+#endif
+
+#ifndef PLATFORM_WEB
+/**
+ * @brief 환경 변수에서 게임 스레드 스케줄링 옵션을 읽습니다
+ * 
+ * SNAKE_GAME_CPU=<번호> 는 게임 스레드를 해당 CPU에 고정하고,
+ * SNAKE_GAME_PRIORITY=normal|high|realtime 은 우선순위를 정합니다.
+ * 
+ * @param app 애플리케이션 상태
+ */
+static void load_thread_options(app_state_t* app) {
+    app->game_cpu = -1;
+    app->game_priority = THREAD_PRIO_NORMAL;
+    
+    const char* cpu = getenv("SNAKE_GAME_CPU");
+    if (cpu && *cpu) {
+        char* end = NULL;
+        long value = strtol(cpu, &end, 10);
+        if (*end == '\0' && value >= 0 && value < platform_cpu_count()) {
+            app->game_cpu = (int)value;
+        }
+    }
+    
+    const char* priority = getenv("SNAKE_GAME_PRIORITY");
+    if (priority) {
+        if (strcmp(priority, "high") == 0) {
+            app->game_priority = THREAD_PRIO_HIGH;
+        } else if (strcmp(priority, "realtime") == 0) {
+            app->game_priority = THREAD_PRIO_REALTIME;
         }
-        
-        // 게임 렌더링
-        game_render(&g_app.game);
+    }
+}
+
+/**
+ * @brief 종료 시 틱 마감 초과 통계와 스케줄링 설정 결과를 출력합니다
+ * 
+ * @param app 애플리케이션 상태
+ */
+static void print_tick_report(const app_state_t* app) {
+    const tick_stats_t* stats = &app->session_stats;
+    if (stats->ticks == 0) return;
+    
+    static const char* priority_names[] = {"normal", "high", "realtime"};
+    if (app->game_cpu >= 0) {
+        printf("게임 스레드: CPU %d 고정%s", app->game_cpu, app->affinity_applied ? "" : " (실패)");
+    } else {
+        printf("게임 스레드: CPU 고정 안 함");
+    }
+    printf(", 우선순위 %s%s\n", priority_names[app->game_priority],
+           app->game_priority == THREAD_PRIO_NORMAL || app->priority_applied ? "" : " (실패 - 권한 필요)");
+    
+    printf("틱 %llu회 중 마감 초과 %u회 (%.2f%%), 평균 지연 %lluus, 최대 지연 %lluus\n",
+           (unsigned long long)stats->ticks, (unsigned)stats->deadline_misses,
+           100.0 * stats->deadline_misses / stats->ticks,
+           (unsigned long long)(stats->total_jitter_us / stats->ticks),
+           (unsigned long long)stats->max_jitter_us);
+}
+
+/**
+ * @brief 한 게임의 틱 통계를 실행 전체 통계에 더합니다
+ * 
+ * @param app 애플리케이션 상태
+ */
+static void accumulate_tick_stats(app_state_t* app) {
+    const tick_stats_t* game_stats = &app->game.tick_stats;
+    tick_stats_t* total = &app->session_stats;
+    
+    total->ticks += game_stats->ticks;
+    total->total_jitter_us += game_stats->total_jitter_us;
+    total->deadline_misses += game_stats->deadline_misses;
+    if (game_stats->max_jitter_us > total->max_jitter_us) {
+        total->max_jitter_us = game_stats->max_jitter_us;
     }
 }
 #endif
 
 /**
- * @brief 게임 루프를 실행하는 스레드 함수
+ * @brief 게임 시뮬레이션을 실행하는 스레드 함수
  *
- * AI 업데이트, 게임 상태 업데이트, 렌더링을 처리합니다.
+ * 단조 시계 기준 고정 간격으로 AI 업데이트와 게임 상태 업데이트만 처리하고, 매 틱의 결과는 스냅샷으로
+ * 발행합니다. 렌더링은 메인 스레드가 최신 스냅샷으로 처리하므로
+ * 시뮬레이션이 렌더러를 기다리는 일은 없습니다.
  * 
  * @param arg 애플리케이션 상태에 대한 포인터
  * @return NULL 반환
@@ -133,33 +339,27 @@ void web_main_loop(void) {
 void* game_thread(void* arg) {
     app_state_t* app = (app_state_t*)arg;
     
+    // 바쁜 호스트에서 선점되어 틱이 늦어지지 않도록 요청된 스케줄링 적용
+    if (app->game_cpu >= 0) {
+        app->affinity_applied = platform_set_thread_affinity(app->game_cpu);
+    }
+    if (app->game_priority != THREAD_PRIO_NORMAL) {
+        app->priority_applied = platform_set_thread_priority(app->game_priority);
+    }
+    
     while (app->running && app->in_game) {
-        uint64_t current_time = platform_get_time_ms();
-        
-        // AI 플레이어 업데이트 - 100ms마다 실행
-        if (current_time - app->last_ai_update_time >= 100) {
-            ai_update_players(&app->game, app->ui.ai_personality);
-            app->last_ai_update_time = current_time;
-        }
-        
-        // 게임 상태 업데이트 - 게임 속도에 따라 실행
-        if (current_time - app->last_update_time >= (uint64_t)app->game.game_speed) {
-            if (!game_update(&app->game)) {
-                app->in_game = false;
-                // 게임 오버 시 화면 완전 정리
-                platform_clear_screen();
-                ui_set_state(&app->ui, UI_STATE_GAME_OVER);
-                ui_show_game_over(&app->ui, &app->game);
-            }
-            app->last_update_time = current_time;
-        }
-        
-        // 게임 렌더링
-        if (app->in_game) {
-            game_render(&app->game);
+        if (!run_due_updates(app, game_clock_now_us(&app->game.clock))) {
+            // 게임 오버 화면은 메인 스레드가 스레드 종료 후 표시
+            app->in_game = false;
+            platform_wake();
+            break;
         }
         
-        platform_sleep(16); // 약 60 FPS 유지
+        // 다음 AI 업데이트나 틱의 절대 시각까지 대기 (가상 시계는 바로 그 시각으로 이동)
+        // (ESC로 나가는 것을 빨리 알아채도록 실제 시간으로 최대 16ms마다는 깨어남)
+        uint64_t next_event = app->next_ai_update_time < app->next_tick_time ?
+                              app->next_ai_update_time : app->next_tick_time;
+        game_clock_sleep_until_us(&app->game.clock, next_event, 16000);
     }
     
     return NULL;
@@ -173,26 +373,57 @@ void* game_thread(void* arg) {
  * @param mode 게임 모드
  */
 void start_game(game_mode_t mode) {
-    if (!game_init(&g_app.game, mode)) {
-        return;
-    }
+    if (g_app.ui.resume_requested) {
+        // 저장된 게임 이어하기 (속도와 진행 상황은 저장 파일을 따름)
+        g_app.ui.resume_requested = false;
+        if (!load_saved_game(&g_app)) {
+            ui_set_state(&g_app.ui, UI_STATE_MAIN_MENU);
+            return;
+        }
+    } else {
+        if (!game_init(&g_app.game, mode)) {
+            return;
+        }
 
-    // UI 설정을 게임에 적용
-    switch (g_app.ui.game_speed_setting) {
-        case 0: // 느림
-            g_app.game.game_speed = 200;
-            break;
-        case 1: // 보통
-            g_app.game.game_speed = 150;
-            break;
-        case 2: // 빠름
-            g_app.game.game_speed = 100;
-            break;
+        // UI 설정을 게임에 적용
+        switch (g_app.ui.game_speed_setting) {
+            case 0: // 느림
+                g_app.game.game_speed = 200;
+                break;
+            case 1: // 보통
+                g_app.game.game_speed = 150;
+                break;
+            case 2: // 빠름
+                g_app.game.game_speed = 100;
+                break;
+        }
+        
+        // 시드와 방향 전환을 리플레이로 기록 (실패해도 게임은 계속)
+        // 이어한 게임은 시작 상태가 시드만으로 재현되지 않으므로 기록하지 않음
+        g_app.game.recorder = replay_recorder_start(&g_app.game, g_app.ui.ai_personality, REPLAY_DIRECTORY);
+    }
+    
+    // 화면에 그리는 게임에만 스냅샷 버퍼를 붙임 (속도 설정이 반영된 첫 스냅샷 발행)
+    if (!game_attach_renderer(&g_app.game)) {
+        finish_recording(&g_app);
+        game_cleanup(&g_app.game);
+        ui_set_state(&g_app.ui, UI_STATE_MAIN_MENU);
+        return;
     }
     
     g_app.in_game = true;
-    g_app.last_update_time = platform_get_time_ms();
-    g_app.last_ai_update_time = g_app.last_update_time;
+    // 관전/검토용 배속 (예: SNAKE_TIME_SCALE=100)
+    const char* time_scale = getenv("SNAKE_TIME_SCALE");
+    if (time_scale) {
+        double scale = atof(time_scale);
+        if (scale > 0.0 && scale != 1.0) {
+            game_clock_set_scale(&g_app.game.clock, scale);
+        }
+    }
+    
+    uint64_t start_time = game_clock_now_us(&g_app.game.clock);
+    g_app.next_tick_time = start_time + (uint64_t)g_app.game.game_speed * 1000;
+    g_app.next_ai_update_time = start_time + AI_UPDATE_INTERVAL_US;
     
 #ifdef PLATFORM_WEB
     // 웹에서는 메인 루프에서 모든 것을 처리
@@ -201,31 +432,60 @@ void start_game(game_mode_t mode) {
     // 네이티브 플랫폼: 게임 스레드 생성
     thread_handle_t game_thread_handle = platform_create_thread(game_thread, &g_app);
 
-    // 입력 처리 루프
+    // 입력 처리 및 렌더링 루프 - 다음 프레임까지 입력을 기다리며 잠듦
+    uint64_t next_frame_time = platform_get_time_ms();
     while (g_app.running && g_app.in_game) {
-        game_key_t key = platform_get_key_pressed();
-
-        // ESC 키로 게임 종료
-        if (key == KEY_ESC) {
-            g_app.in_game = false;
-            ui_set_state(&g_app.ui, UI_STATE_MAIN_MENU);
-            platform_clear_screen();
-            break;
+        uint64_t current_time = platform_get_time_ms();
+        if (current_time < next_frame_time) {
+            platform_wait_input((uint32_t)(next_frame_time - current_time));
         }
 
-        // 사용자 입력 처리 (플레이어 0만)
-        game_handle_input(&g_app.game, 0, key);
-        platform_sleep(16);
+        // 쌓인 입력을 모두 처리
+        game_key_t key;
+        while ((key = platform_get_key_pressed()) != KEY_NONE) {
+            // ESC 키로 게임 종료
+            if (key == KEY_ESC) {
+                g_app.in_game = false;
+                ui_set_state(&g_app.ui, UI_STATE_MAIN_MENU);
+                platform_clear_screen();
+                break;
+            }
+
+            // 사용자 입력 처리 (플레이어 0만)
+            game_handle_input(&g_app.game, 0, key);
+        }
+        if (!g_app.in_game) break;
+        
+        // 최신 스냅샷으로 렌더링 (잠금 없음) - 약 60 FPS
+        current_time = platform_get_time_ms();
+        if (current_time >= next_frame_time) {
+            game_snapshot_t* snapshot = game_acquire_snapshot(&g_app.game);
+            game_update_smooth_motion(snapshot, game_clock_now_ms(&g_app.game.clock));
+            game_render(snapshot);
+            next_frame_time = current_time + 16;
+        }
     }
 
     // 게임 스레드가 끝날 때까지 대기
     platform_join_thread(game_thread_handle);
+    finish_recording(&g_app);
+    
+    // ESC로 떠난 게임은 다음에 이어할 수 있도록 저장
+    if (!g_app.in_game) {
+        save_unfinished_game(&g_app);
+    }
 
     // 게임 종료 시 화면 완전 정리
     if (!g_app.in_game) {
         platform_clear_screen();
     }
+    
+    // 게임 오버로 끝났으면 결과 화면 표시 (스레드 종료 후라 게임 상태를 안전하게 읽음)
+    if (g_app.game.game_over && g_app.ui.current_state == UI_STATE_PLAYING) {
+        show_game_over(&g_app);
+    }
 
+    accumulate_tick_stats(&g_app);
     game_cleanup(&g_app.game);
 #endif
 }
@@ -244,10 +504,20 @@ int main(void) {
         return 1;
     }
     
+    // 화면 출력 녹화 (예: SNAKE_CAPTURE=session.cast, asciinema play로 재생)
+    const char* capture_path = getenv(CAPTURE_ENV);
+    if (capture_path && *capture_path && !capture_start(capture_path, 120, 50)) {
+        fprintf(stderr, "화면 녹화 파일을 만들 수 없습니다: %s\n", capture_path);
+    }
+    
     // 애플리케이션 초기화
     g_app.running = true;
     g_app.in_game = false;
     ui_init(&g_app.ui);
+    ui_set_saved_game_available(&g_app.ui, resume_file_exists());
+    
+    // 경기 기록 저장소 (열지 못해도 게임은 가능, 순위만 표시 안 함)
+    g_app.scores = score_store_open(SCORE_STORE_DIRECTORY);
 
     // 콘솔 설정
     platform_hide_cursor();
@@ -262,6 +532,7 @@ int main(void) {
     return 0;
 #else
     // 네이티브 플랫폼: 기존 메인 루프
+    load_thread_options(&g_app);
     while (g_app.running) {
         if (!g_app.in_game) {
             // UI 처리
@@ -281,24 +552,28 @@ int main(void) {
                     }
                     
                     // 종료 확인
-                    if (g_app.ui.current_state == UI_STATE_MAIN_MENU && 
-                        g_app.ui.selected_option == 3 && key == KEY_ENTER) {
+                    if (g_app.ui.exit_requested) {
                         g_app.running = false;
                     }
                 }
+            } else {
+                // 다음 입력이 올 때까지 잠듦 (메뉴는 입력이 있을 때만 바뀌고,
+                // ui_render는 바뀐 영역이 없으면 아무것도 그리지 않음)
+                platform_wait_input(PLATFORM_WAIT_FOREVER);
             }
         } else {
             // 게임이 별도 스레드에서 실행 중
-            platform_sleep(16);
+            platform_wait_input(16);
         }
-        
-        platform_sleep(16); // 약 60 FPS 유지
     }
 
+    score_store_close(g_app.scores);
     ui_cleanup(&g_app.ui);
     platform_cleanup();
+    capture_stop();
     
     printf("게임을 종료합니다. 플레이해주셔서 감사합니다!\n");
+    print_tick_report(&g_app);
     return 0;
 #endif
 }
@@ -0,0 +1,159 @@
+#include "async_writer.h"
+#include "platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 이만큼 쌓이면 기록 스레드를 깨움 (작은 쓰기를 모아서 처리)
+#define ASYNC_WRITER_CHUNK 4096
+
+/**
+ * @brief 비동기 기록기 내부 구조체
+ *
+ * 쓰는 쪽은 pending 버퍼에 추가만 하고, 기록 스레드는 pending과
+ * 자신의 버퍼를 맞바꾼 뒤 잠금 밖에서 파일에 씁니다.
+ */
+struct async_writer {
+    FILE* file;                    // 대상 파일
+    mutex_handle_t mutex;          // 아래 필드 보호
+    cond_handle_t wake;            // 기록 스레드 깨우기
+    thread_handle_t thread;        // 기록 스레드 (없으면 동기 기록)
+    bool has_thread;               // 기록 스레드 실행 여부
+    char* pending;                 // 아직 파일에 쓰지 않은 데이터
+    size_t pending_size;           // pending 바이트 수
+    size_t pending_capacity;       // pending 할당 크기
+    bool closing;                  // 닫기 요청
+    bool failed;                   // 쓰기 실패 여부
+};
+
+/**
+ * @brief pending 버퍼가 size 바이트를 더 담을 수 있도록 늘립니다
+ */
+static bool reserve_pending(async_writer_t* writer, size_t size) {
+    size_t needed = writer->pending_size + size;
+    if (needed <= writer->pending_capacity) return true;
+
+    size_t capacity = writer->pending_capacity ? writer->pending_capacity : ASYNC_WRITER_CHUNK;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+
+    char* buffer = realloc(writer->pending, capacity);
+    if (!buffer) return false;
+    writer->pending = buffer;
+    writer->pending_capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief 데이터를 파일에 씁니다 (잠금 밖에서 호출)
+ */
+static bool write_block(FILE* file, const char* data, size_t size) {
+    if (size == 0) return true;
+    return fwrite(data, 1, size, file) == size && fflush(file) == 0;
+}
+
+static void* writer_main(void* arg) {
+    async_writer_t* writer = (async_writer_t*)arg;
+    char* spare = NULL;            // 기록 스레드가 쥐고 있는 빈 버퍼
+    size_t spare_capacity = 0;
+
+    platform_lock_mutex(writer->mutex);
+    for (;;) {
+        while (writer->pending_size == 0 && !writer->closing) {
+            platform_cond_wait(writer->wake, writer->mutex);
+        }
+        if (writer->pending_size == 0) break;  // 닫기 요청이고 남은 데이터 없음
+
+        // 버퍼를 맞바꾸고 잠금을 푼 상태로 파일에 씀
+        char* data = writer->pending;
+        size_t size = writer->pending_size;
+        size_t data_capacity = writer->pending_capacity;
+        writer->pending = spare;
+        writer->pending_capacity = spare_capacity;
+        writer->pending_size = 0;
+        platform_unlock_mutex(writer->mutex);
+
+        bool ok = write_block(writer->file, data, size);
+        spare = data;
+        spare_capacity = data_capacity;
+
+        platform_lock_mutex(writer->mutex);
+        if (!ok) writer->failed = true;
+    }
+    platform_unlock_mutex(writer->mutex);
+
+    free(spare);
+    return NULL;
+}
+
+async_writer_t* async_writer_open(const char* path) {
+    if (!path) return NULL;
+
+    async_writer_t* writer = calloc(1, sizeof(async_writer_t));
+    if (!writer) return NULL;
+
+    writer->file = fopen(path, "wb");
+    if (!writer->file) {
+        free(writer);
+        return NULL;
+    }
+
+    writer->mutex = platform_create_mutex();
+    writer->wake = platform_create_cond();
+
+    // 조건 변수가 없는 플랫폼(웹)은 스레드 없이 동기 기록
+    if (writer->mutex.handle && writer->wake.handle) {
+        writer->thread = platform_create_thread(writer_main, writer);
+        writer->has_thread = writer->thread.handle != NULL;
+    }
+    return writer;
+}
+
+bool async_writer_write(async_writer_t* writer, const void* data, size_t size) {
+    if (!writer || (!data && size > 0)) return false;
+
+    platform_lock_mutex(writer->mutex);
+    bool ok = !writer->failed && reserve_pending(writer, size);
+    if (ok && size > 0) {
+        memcpy(writer->pending + writer->pending_size, data, size);
+        writer->pending_size += size;
+
+        if (writer->pending_size >= ASYNC_WRITER_CHUNK) {
+            if (writer->has_thread) {
+                platform_cond_signal(writer->wake);
+            } else {
+                ok = write_block(writer->file, writer->pending, writer->pending_size);
+                writer->failed = !ok;
+                writer->pending_size = 0;
+            }
+        }
+    }
+    platform_unlock_mutex(writer->mutex);
+    return ok;
+}
+
+bool async_writer_close(async_writer_t* writer) {
+    if (!writer) return false;
+
+    if (writer->has_thread) {
+        platform_lock_mutex(writer->mutex);
+        writer->closing = true;
+        platform_cond_signal(writer->wake);
+        platform_unlock_mutex(writer->mutex);
+        platform_join_thread(writer->thread);
+    } else if (!writer->failed) {
+        writer->failed = !write_block(writer->file, writer->pending, writer->pending_size);
+    }
+
+    bool ok = !writer->failed;
+    if (fclose(writer->file) != 0) {
+        ok = false;
+    }
+
+    platform_destroy_cond(writer->wake);
+    platform_destroy_mutex(writer->mutex);
+    free(writer->pending);
+    free(writer);
+    return ok;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file async_writer.h
+ * @brief 백그라운드 스레드가 파일에 쓰는 버퍼링 기록기
+ *
+ * async_writer_write는 메모리 버퍼에 복사만 하고 바로 돌아오며,
+ * 실제 파일 쓰기는 전용 스레드가 모아서 처리합니다. 그래서 게임 틱처럼
+ * 지연에 민감한 곳에서도 디스크 I/O를 기다리지 않고 기록할 수 있습니다.
+ * 스레드를 만들 수 없는 플랫폼(웹)에서는 버퍼가 찰 때와 닫을 때 직접 씁니다.
+ */
+
+#ifndef ASYNC_WRITER_H
+#define ASYNC_WRITER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief 비동기 파일 기록기 (불투명 타입)
+ */
+typedef struct async_writer async_writer_t;
+
+/**
+ * @brief 파일을 새로 만들고 기록 스레드 시작
+ * @param path 파일 경로 (이미 있으면 덮어씀)
+ * @return 기록기, 파일을 열 수 없으면 NULL
+ */
+async_writer_t* async_writer_open(const char* path);
+
+/**
+ * @brief 데이터를 기록 대기열에 추가 (파일 쓰기를 기다리지 않음)
+ * @param writer 기록기
+ * @param data 기록할 데이터
+ * @param size 바이트 수
+ * @return 메모리가 부족하거나 이전 쓰기가 실패했으면 false
+ */
+bool async_writer_write(async_writer_t* writer, const void* data, size_t size);
+
+/**
+ * @brief 남은 데이터를 모두 쓰고 파일을 닫은 뒤 기록기 해제
+ * @param writer 기록기
+ * @return 모든 데이터를 문제없이 썼으면 true
+ */
+bool async_writer_close(async_writer_t* writer);
+
+#endif // ASYNC_WRITER_H
@@ -0,0 +1,115 @@
+#include "capture.h"
+#include "async_writer.h"
+#include "platform.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 이벤트 한 줄의 최대 길이 (넘으면 같은 시각의 이벤트로 나눔)
+#define CAPTURE_EVENT_MAX 8192
+// 문자 하나를 이스케이프했을 때의 최대 길이 ("\u001b")와 이벤트 끝 ("\"]\n")
+#define CAPTURE_ESCAPE_MAX 6
+#define CAPTURE_EVENT_TAIL 3
+// 글자 경계에서 나누려고 미뤄 둘 수 있는 UTF-8 연속 바이트 수 (4바이트 글자의 나머지)
+#define CAPTURE_CONTINUATION_MAX 3
+
+static async_writer_t* g_capture_writer = NULL;
+static mutex_handle_t g_capture_mutex;
+static uint64_t g_capture_start_us = 0;
+static char g_capture_event[CAPTURE_EVENT_MAX];  // g_capture_mutex로 보호
+
+/**
+ * @brief JSON 문자열에 넣을 수 있도록 이스케이프한 바이트를 out에 씁니다
+ * @return 쓴 바이트 수
+ */
+static size_t escape_byte(unsigned char c, char* out) {
+    static const char hex[] = "0123456789abcdef";
+
+    switch (c) {
+        case '"':  out[0] = '\\'; out[1] = '"';  return 2;
+        case '\\': out[0] = '\\'; out[1] = '\\'; return 2;
+        case '\n': out[0] = '\\'; out[1] = 'n';  return 2;
+        case '\r': out[0] = '\\'; out[1] = 'r';  return 2;
+        case '\t': out[0] = '\\'; out[1] = 't';  return 2;
+        default:
+            break;
+    }
+    if (c < 0x20 || c == 0x7f) {
+        memcpy(out, "\\u00", 4);
+        out[4] = hex[c >> 4];
+        out[5] = hex[c & 0x0f];
+        return 6;
+    }
+    // UTF-8 바이트는 그대로 (JSON 문자열은 UTF-8을 허용)
+    out[0] = (char)c;
+    return 1;
+}
+
+bool capture_start(const char* path, int width, int height) {
+    if (g_capture_writer || !path || !*path) return false;
+
+    async_writer_t* writer = async_writer_open(path);
+    if (!writer) return false;
+
+    const char* term = getenv("TERM");
+    char header[256];
+    int n = snprintf(header, sizeof(header),
+                     "{\"version\": 2, \"width\": %d, \"height\": %d, \"timestamp\": %lld, "
+                     "\"env\": {\"TERM\": \"%s\"}}\n",
+                     width, height, (long long)time(NULL),
+                     term && !strpbrk(term, "\"\\") ? term : "xterm-256color");
+    if (n <= 0 || (size_t)n >= sizeof(header) || !async_writer_write(writer, header, (size_t)n)) {
+        async_writer_close(writer);
+        return false;
+    }
+
+    g_capture_mutex = platform_create_mutex();
+    g_capture_start_us = platform_get_time_us();
+    g_capture_writer = writer;
+    return true;
+}
+
+void capture_output(const char* data, size_t len) {
+    if (!g_capture_writer || len == 0) return;
+
+    platform_lock_mutex(g_capture_mutex);
+
+    // 출력 순서대로 기록되도록 시각도 잠금 안에서 읽음
+    double elapsed = (double)(platform_get_time_us() - g_capture_start_us) / 1000000.0;
+    int prefix = snprintf(g_capture_event, CAPTURE_EVENT_MAX, "[%.6f, \"o\", \"", elapsed);
+    size_t used = (size_t)prefix;
+
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)data[i];
+
+        // 버퍼가 거의 차면 글자 경계(연속 바이트가 아닌 곳)에서 이벤트를 나눔.
+        // 연속 바이트는 그대로 한 바이트씩 들어가므로 올바른 UTF-8이면 남겨 둔 여유 안에서
+        // 경계가 나오고, 연속 바이트가 그보다 길게 이어지면(잘못된 입력) 그 자리에서 나눔
+        size_t needed = used + CAPTURE_ESCAPE_MAX + CAPTURE_EVENT_TAIL;
+        bool boundary = (c & 0xc0) != 0x80;
+        if (needed > CAPTURE_EVENT_MAX || (boundary && needed + CAPTURE_CONTINUATION_MAX > CAPTURE_EVENT_MAX)) {
+            memcpy(g_capture_event + used, "\"]\n", CAPTURE_EVENT_TAIL);
+            async_writer_write(g_capture_writer, g_capture_event, used + CAPTURE_EVENT_TAIL);
+            used = (size_t)prefix;
+        }
+        used += escape_byte(c, g_capture_event + used);
+    }
+
+    memcpy(g_capture_event + used, "\"]\n", CAPTURE_EVENT_TAIL);
+    async_writer_write(g_capture_writer, g_capture_event, used + CAPTURE_EVENT_TAIL);
+
+    platform_unlock_mutex(g_capture_mutex);
+}
+
+bool capture_stop(void) {
+    if (!g_capture_writer) return false;
+
+    platform_lock_mutex(g_capture_mutex);
+    async_writer_t* writer = g_capture_writer;
+    g_capture_writer = NULL;
+    platform_unlock_mutex(g_capture_mutex);
+
+    platform_destroy_mutex(g_capture_mutex);
+    return async_writer_close(writer);
+}
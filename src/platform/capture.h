@@ -0,0 +1,43 @@
+/**
+ * @file capture.h
+ * @brief 터미널 출력을 asciicast v2 파일로 녹화하는 캡처 모드
+ *
+ * 백엔드가 터미널에 쓰는 바이트(이스케이프 시퀀스 포함)를 시각과 함께
+ * 그대로 기록하므로, "화면이 깨졌다"는 제보를 asciinema play 등으로
+ * 같은 터미널 출력 그대로 다시 볼 수 있습니다. 파일 쓰기는 async_writer가
+ * 백그라운드에서 처리하고, 출력 경로에서는 JSON 이스케이프와 복사만 합니다.
+ *
+ * 파일 형식: 첫 줄은 헤더 객체, 이후 한 줄마다 [경과 초, "o", "출력"] 이벤트
+ */
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#define CAPTURE_ENV "SNAKE_CAPTURE"    // 녹화 파일 경로를 지정하는 환경 변수
+
+/**
+ * @brief 녹화 시작 (이미 녹화 중이면 아무것도 하지 않음)
+ * @param path 녹화 파일 경로 (이미 있으면 덮어씀)
+ * @param width 터미널 폭 (열)
+ * @param height 터미널 높이 (행)
+ * @return 녹화를 시작했으면 true
+ */
+bool capture_start(const char* path, int width, int height);
+
+/**
+ * @brief 터미널에 쓴 바이트를 녹화에 추가 (녹화 중이 아니면 바로 반환)
+ * @param data 출력 바이트 (UTF-8)
+ * @param len 바이트 수
+ */
+void capture_output(const char* data, size_t len);
+
+/**
+ * @brief 남은 기록을 모두 쓰고 녹화 종료
+ * @return 녹화 중이었고 모든 기록을 문제없이 썼으면 true
+ */
+bool capture_stop(void);
+
+#endif // CAPTURE_H
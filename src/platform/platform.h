@@ -11,6 +11,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 // 플랫폼 식별
 #if defined(PLATFORM_MACOS) || defined(PLATFORM_WINDOWS) || defined(PLATFORM_WEB) || defined(PLATFORM_UNIX)
@@ -78,11 +79,75 @@ typedef struct {
     void* handle;                  // 플랫폼별 뮤텍스 핸들
 } mutex_handle_t;
 
+/**
+ * @brief 조건 변수 핸들 구조체
+ */
+typedef struct {
+    void* handle;                  // 플랫폼별 조건 변수 핸들
+} cond_handle_t;
+
+/**
+ * @brief 세마포어 핸들 구조체
+ */
+typedef struct {
+    void* handle;                  // 플랫폼별 세마포어 핸들
+} semaphore_handle_t;
+
+/**
+ * @brief 스레드 지역 저장소 키 구조체
+ */
+typedef struct {
+    void* handle;                  // 플랫폼별 TLS 키
+} tls_key_t;
+
+/**
+ * @brief 스레드 스케줄링 우선순위
+ */
+typedef enum {
+    THREAD_PRIO_NORMAL = 0,        // 운영체제 기본값
+    THREAD_PRIO_HIGH,              // 높은 우선순위 (Unix: nice -10, Windows: HIGHEST)
+    THREAD_PRIO_REALTIME           // 실시간 (Unix: SCHED_FIFO, Windows: TIME_CRITICAL)
+} thread_priority_t;
+
+/**
+ * @brief 읽기 전용으로 메모리에 매핑한 파일
+ */
+typedef struct {
+    const uint8_t* data;           // 파일 내용
+    size_t size;                   // 파일 크기
+    void* handle;                  // 플랫폼별 매핑 핸들
+} mapped_file_t;
+
 /**
  * @brief 스레드 함수 포인터 타입
  */
 typedef void* (*thread_func_t)(void* arg);
 
+// 디렉터리 항목 콜백 (파일 이름만 전달, 경로는 호출한 쪽에서 붙임)
+typedef void (*dir_entry_func_t)(const char* name, void* user);
+
+/**
+ * @brief 소켓 이벤트 대기기 (Linux는 epoll, 불투명 타입)
+ */
+typedef struct net_poller net_poller_t;
+
+// 소켓 이벤트 플래그
+#define NET_EVENT_READ   0x1       // 읽을 데이터가 있거나 새 연결이 들어옴
+#define NET_EVENT_WRITE  0x2       // 보낼 수 있음 (연결 완료 포함)
+#define NET_EVENT_HANGUP 0x4       // 상대가 끊었거나 오류
+
+// platform_net_send/recv 실패 값
+#define NET_AGAIN (-1)             // 지금은 읽을 데이터가 없음
+#define NET_ERROR (-2)             // 연결 오류
+
+/**
+ * @brief 준비된 소켓 이벤트 하나
+ */
+typedef struct {
+    void* user;                    // 등록할 때 넘긴 값
+    int events;                    // NET_EVENT_* 조합
+} net_event_t;
+
 // 플랫폼 초기화 및 정리
 bool platform_init(void);
 void platform_cleanup(void);
@@ -94,24 +159,33 @@ void platform_set_color(color_t color);
 void platform_reset_color(void);
 void platform_print(const char* text);
 void platform_print_at(int x, int y, const char* text);
+void platform_clear_area(int x, int y, int width, int height);  // 사각 영역을 공백으로 채우기
+void platform_clear_line(int y);                                // 한 줄 전체 지우기
 void platform_hide_cursor(void);
 void platform_show_cursor(void);
 void platform_set_console_size(int width, int height);
-void platform_present_buffer(void);  // 더블 버퍼링 출력 함수 (Windows 전용)
+void platform_present_buffer(void);  // 가상 화면의 변경분만 실제 화면에 출력
 
 // 입력 처리 함수들
+#define PLATFORM_WAIT_FOREVER UINT32_MAX  // platform_wait_input 시간 제한 없음
 game_key_t platform_get_key_pressed(void);
 bool platform_is_key_down(game_key_t key);
+bool platform_wait_input(uint32_t timeout_ms);  // 입력이 들어오거나 깨우기/시간 초과까지 대기 (입력이 있으면 true)
+void platform_wake(void);                       // 다른 스레드에서 platform_wait_input 대기를 즉시 깨우기
 
 // 타이밍 관련 함수들
 void platform_sleep(uint32_t ms);
-uint64_t platform_get_time_ms(void);
+uint64_t platform_get_time_ms(void);              // 단조 증가 시계 (밀리초)
+uint64_t platform_get_time_us(void);              // 단조 증가 시계 (마이크로초)
+void platform_sleep_until_us(uint64_t deadline_us);  // 절대 시각(platform_get_time_us 기준)까지 대기
 
 // 스레딩 관련 함수들
 thread_handle_t platform_create_thread(thread_func_t func, void* arg);
 void platform_join_thread(thread_handle_t thread);
 void platform_detach_thread(thread_handle_t thread);
 bool platform_thread_running(thread_handle_t thread);
+bool platform_set_thread_affinity(int cpu);                     // 호출한 스레드를 CPU 하나에 고정 (성공하면 true)
+bool platform_set_thread_priority(thread_priority_t priority);  // 호출한 스레드의 우선순위 변경 (권한이 없으면 false)
 
 // 뮤텍스 관련 함수들
 mutex_handle_t platform_create_mutex(void);
@@ -119,6 +193,60 @@ void platform_destroy_mutex(mutex_handle_t mutex);
 void platform_lock_mutex(mutex_handle_t mutex);
 void platform_unlock_mutex(mutex_handle_t mutex);
 
+// 조건 변수 관련 함수들 (mutex는 platform_create_mutex로 만든 것)
+cond_handle_t platform_create_cond(void);
+void platform_destroy_cond(cond_handle_t cond);
+void platform_cond_wait(cond_handle_t cond, mutex_handle_t mutex);
+bool platform_cond_timed_wait(cond_handle_t cond, mutex_handle_t mutex, uint32_t timeout_ms);  // 신호를 받으면 true
+void platform_cond_signal(cond_handle_t cond);
+void platform_cond_broadcast(cond_handle_t cond);
+
+// 세마포어 관련 함수들
+semaphore_handle_t platform_create_semaphore(uint32_t initial_count);
+void platform_destroy_semaphore(semaphore_handle_t semaphore);
+void platform_semaphore_wait(semaphore_handle_t semaphore);
+bool platform_semaphore_try_wait(semaphore_handle_t semaphore);
+void platform_semaphore_post(semaphore_handle_t semaphore);
+
+// 원자적 연산 함수들 (C11 atomic 스타일 래퍼, 스레드 간 잠금 없는 데이터 교환용)
+int32_t platform_atomic_load(volatile int32_t* value);
+void platform_atomic_store(volatile int32_t* value, int32_t new_value);
+int32_t platform_atomic_exchange(volatile int32_t* value, int32_t new_value);
+int32_t platform_atomic_fetch_add(volatile int32_t* value, int32_t delta);  // 더하기 전 값 반환
+bool platform_atomic_compare_exchange(volatile int32_t* value, int32_t* expected, int32_t desired);
+int64_t platform_atomic_load64(volatile int64_t* value);
+void platform_atomic_store64(volatile int64_t* value, int64_t new_value);
+int64_t platform_atomic_fetch_add64(volatile int64_t* value, int64_t delta);
+
+// 스레드 지역 저장소 관련 함수들
+tls_key_t platform_tls_create(void);
+void platform_tls_destroy(tls_key_t key);
+void* platform_tls_get(tls_key_t key);
+void platform_tls_set(tls_key_t key, void* value);
+
+// 시스템 정보
+int platform_cpu_count(void);  // 사용 가능한 논리 CPU 수 (스레드가 없는 플랫폼은 1)
+
+// 파일 시스템
+bool platform_create_directory(const char* path);  // 디렉터리 만들기 (이미 있어도 true)
+bool platform_map_file(const char* path, mapped_file_t* file);  // 파일 전체를 읽기 전용으로 매핑
+void platform_unmap_file(mapped_file_t* file);
+bool platform_list_directory(const char* path, dir_entry_func_t callback, void* user);  // 일반 파일만, 순서 없음
+
+// 네트워크 (논블로킹 소켓, 주소는 "호스트:포트" 또는 "unix:경로", 호스트가 *이면 모든 주소)
+int platform_net_listen(const char* address);                         // 실패하면 -1
+int platform_net_accept(int listener);                                // 대기 중인 연결이 없으면 -1
+int platform_net_connect(const char* address);                        // 연결 중일 수 있음 (쓰기 가능해지면 완료)
+long platform_net_send(int socket, const void* data, size_t size);    // 보낸 바이트 (버퍼가 차면 0) 또는 NET_ERROR
+long platform_net_recv(int socket, void* data, size_t size);          // 받은 바이트, 0이면 상대가 닫음, NET_AGAIN/NET_ERROR
+void platform_net_close(int socket);
+net_poller_t* platform_poller_create(void);
+void platform_poller_destroy(net_poller_t* poller);
+bool platform_poller_add(net_poller_t* poller, int socket, int events, void* user);
+bool platform_poller_modify(net_poller_t* poller, int socket, int events, void* user);
+void platform_poller_remove(net_poller_t* poller, int socket);
+int platform_poller_wait(net_poller_t* poller, net_event_t* events, int max_events, int timeout_ms);  // 준비된 수, 실패 -1
+
 // 유틸리티 함수들
 int platform_random(int min, int max);
 void platform_seed_random(uint32_t seed);
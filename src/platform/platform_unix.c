@@ -1,4 +1,10 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE  // pthread_setaffinity_np, CPU_SET
+#endif
+
 #include "platform.h"
+#include "screen.h"
+#include "capture.h"
 
 #if defined(PLATFORM_MACOS) || defined(PLATFORM_UNIX)
 
@@ -7,14 +13,78 @@
 #include <unistd.h>
 #include <termios.h>
 #include <sys/ioctl.h>
-#include <sys/time.h>
 #include <pthread.h>
+#include <sched.h>
 #include <fcntl.h>
 #include <time.h>
+#include <poll.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <dirent.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <sys/epoll.h>
+#endif
 
 static struct termios g_original_termios;
 static bool g_termios_saved = false;
 
+// platform_wait_input을 다른 스레드에서 깨우기 위한 파일 디스크립터
+// (Linux는 eventfd 하나, 그 외에는 파이프의 읽기/쓰기 끝)
+static int g_wake_read_fd = -1;
+static int g_wake_write_fd = -1;
+
+/**
+ * @brief 터미널로 바이트를 보냅니다 (캡처 중이면 녹화에도 추가)
+ */
+static void terminal_write(const char* data, size_t len) {
+    fwrite(data, 1, len, stdout);
+    capture_output(data, len);
+}
+
+/**
+ * @brief 깨우기용 eventfd(또는 파이프)를 만듭니다
+ */
+static void create_wake_fd(void) {
+#ifdef __linux__
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd >= 0) {
+        g_wake_read_fd = fd;
+        g_wake_write_fd = fd;
+        return;
+    }
+#endif
+    int fds[2];
+    if (pipe(fds) == 0) {
+        for (int i = 0; i < 2; i++) {
+            fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL, 0) | O_NONBLOCK);
+            fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+        }
+        g_wake_read_fd = fds[0];
+        g_wake_write_fd = fds[1];
+    }
+}
+
+/**
+ * @brief 쌓인 깨우기 신호를 모두 비웁니다
+ */
+static void drain_wake_fd(void) {
+    uint64_t buffer[8];
+    while (read(g_wake_read_fd, buffer, sizeof(buffer)) > 0) {
+        // eventfd는 한 번에 카운터 전체를, 파이프는 남은 바이트를 비움
+    }
+}
+
 bool platform_init(void) {
     // 원래 터미널 설정 저장
     if (tcgetattr(STDIN_FILENO, &g_original_termios) == 0) {
@@ -32,108 +102,260 @@ bool platform_init(void) {
         fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
     }
     
+    create_wake_fd();
+    screen_init();
     srand((unsigned int)time(NULL));
     return true;
 }
 
 void platform_cleanup(void) {
-    platform_reset_color();
+    terminal_write("\033[0m", 4);
     platform_show_cursor();
     
     // 원래 터미널 설정 복원
     if (g_termios_saved) {
         tcsetattr(STDIN_FILENO, TCSAFLUSH, &g_original_termios);
     }
+    
+    // 깨우기용 디스크립터 닫기
+    if (g_wake_write_fd >= 0 && g_wake_write_fd != g_wake_read_fd) {
+        close(g_wake_write_fd);
+    }
+    if (g_wake_read_fd >= 0) {
+        close(g_wake_read_fd);
+    }
+    g_wake_read_fd = g_wake_write_fd = -1;
 }
 
-void platform_clear_screen(void) {
-    printf("\033[2J\033[H");
+void platform_hide_cursor(void) {
+    terminal_write("\033[?25l", 6);
     fflush(stdout);
 }
 
-void platform_goto_xy(int x, int y) {
-    printf("\033[%d;%dH", y + 1, x + 1);
+void platform_show_cursor(void) {
+    terminal_write("\033[?25h", 6);
     fflush(stdout);
 }
 
-void platform_set_color(color_t color) {
-    const char* color_codes[] = {
-        "\033[30m", "\033[34m", "\033[32m", "\033[36m",
-        "\033[31m", "\033[35m", "\033[33m", "\033[37m",
-        "\033[90m", "\033[94m", "\033[92m", "\033[96m",
-        "\033[91m", "\033[95m", "\033[93m", "\033[97m"
-    };
-    
-    if (color < 16) {
-        printf("%s", color_codes[color]);
-        fflush(stdout);
-    }
+void platform_set_console_size(int width, int height) {
+    // Unix에서는 터미널 창의 크기를 안정적으로 조정할 수 없음
+    // 이는 일반적으로 터미널 에뮬레이터에서 처리됨
+    (void)width;
+    (void)height;
 }
 
-void platform_reset_color(void) {
-    printf("\033[0m");
-    fflush(stdout);
+// 입력 디코더 설정
+#define INPUT_BUFFER_SIZE 256       // 아직 해석하지 않은 입력 바이트 버퍼
+#define KEY_QUEUE_SIZE 64           // 해석된 키 큐 (2의 거듭제곱)
+#define ESCAPE_TIMEOUT_MS 25        // 불완전한 ESC 시퀀스를 기다리는 최대 시간
+
+// 입력 디코더 상태
+static unsigned char g_input_buffer[INPUT_BUFFER_SIZE];
+static size_t g_input_length = 0;
+static uint64_t g_incomplete_since = 0;    // 불완전한 시퀀스가 남기 시작한 시각 (0이면 없음)
+static game_key_t g_key_queue[KEY_QUEUE_SIZE];
+static unsigned g_key_head = 0;
+static unsigned g_key_tail = 0;
+
+/**
+ * @brief 해석된 키를 큐에 넣습니다 (가득 차면 버림)
+ */
+static void push_key(game_key_t key) {
+    if (key == KEY_NONE || g_key_tail - g_key_head >= KEY_QUEUE_SIZE) return;
+    g_key_queue[g_key_tail++ % KEY_QUEUE_SIZE] = key;
 }
 
-void platform_print(const char* text) {
-    printf("%s", text);
-    fflush(stdout);
+/**
+ * @brief 일반 문자 한 바이트를 키로 변환합니다
+ */
+static game_key_t map_plain_key(unsigned char ch) {
+    switch (ch) {
+        case '\n': case '\r': return KEY_ENTER;
+        case ' ': return KEY_SPACE;
+        case 'w': case 'W': return KEY_W;
+        case 'a': case 'A': return KEY_A;
+        case 's': case 'S': return KEY_S;
+        case 'd': case 'D': return KEY_D;
+        case '1': return KEY_1;
+        case '2': return KEY_2;
+        case '3': return KEY_3;
+        case '4': return KEY_4;
+        default: return KEY_NONE;
+    }
 }
 
-void platform_print_at(int x, int y, const char* text) {
-    platform_goto_xy(x, y);
-    platform_print(text);
+/**
+ * @brief 화살표 시퀀스의 마지막 문자를 키로 변환합니다 (CSI/SS3 공통)
+ */
+static game_key_t map_arrow_final(unsigned char final) {
+    switch (final) {
+        case 'A': return KEY_UP;
+        case 'B': return KEY_DOWN;
+        case 'C': return KEY_RIGHT;
+        case 'D': return KEY_LEFT;
+        default: return KEY_NONE;
+    }
 }
 
-void platform_hide_cursor(void) {
-    printf("\033[?25l");
-    fflush(stdout);
+/**
+ * @brief ESC로 시작하는 시퀀스 하나를 해석합니다
+ * 
+ * CSI(ESC [ 매개변수... 최종문자)와 SS3(ESC O 문자)를 지원하며,
+ * 수정자가 붙은 화살표(ESC [ 1 ; 5 A 등)도 화살표로 처리합니다.
+ * 
+ * @param data ESC부터 시작하는 바이트
+ * @param length 사용 가능한 바이트 수
+ * @param key 해석된 키 (인식하지 못한 시퀀스면 KEY_NONE)
+ * @return 소비한 바이트 수, 시퀀스가 아직 다 오지 않았으면 0
+ */
+static size_t decode_escape(const unsigned char* data, size_t length, game_key_t* key) {
+    *key = KEY_NONE;
+    if (length < 2) return 0;
+    
+    if (data[1] == '[') {
+        // CSI: 매개변수(0x30-0x3F)와 중간 바이트(0x20-0x2F) 다음 최종 바이트(0x40-0x7E)
+        for (size_t i = 2; i < length; i++) {
+            if (data[i] >= 0x40 && data[i] <= 0x7E) {
+                *key = map_arrow_final(data[i]);
+                return i + 1;
+            }
+            if (data[i] < 0x20 || data[i] > 0x3F) {
+                // 잘못된 시퀀스 - ESC 키 하나로 보고 나머지는 일반 입력으로 해석
+                *key = KEY_ESC;
+                return 1;
+            }
+        }
+        return 0;
+    }
+    
+    if (data[1] == 'O') {
+        // SS3: 애플리케이션 커서 모드의 화살표 (ESC O A 등)
+        if (length < 3) return 0;
+        *key = map_arrow_final(data[2]);
+        return 3;
+    }
+    
+    // 다른 문자가 뒤따르면 ESC 단독 입력
+    *key = KEY_ESC;
+    return 1;
 }
 
-void platform_show_cursor(void) {
-    printf("\033[?25h");
-    fflush(stdout);
+/**
+ * @brief 버퍼에 쌓인 입력을 가능한 만큼 키로 해석합니다
+ * 
+ * @param flush_incomplete 불완전한 ESC 시퀀스를 기다리지 않고 ESC 키로 처리할지 여부
+ */
+static void decode_input(bool flush_incomplete) {
+    size_t pos = 0;
+    
+    while (pos < g_input_length) {
+        unsigned char ch = g_input_buffer[pos];
+        
+        if (ch != 27) {
+            push_key(map_plain_key(ch));
+            pos++;
+            continue;
+        }
+        
+        game_key_t key;
+        size_t used = decode_escape(g_input_buffer + pos, g_input_length - pos, &key);
+        if (used == 0) {
+            if (!flush_incomplete) break;  // 나머지 바이트가 오기를 기다림
+            
+            // 시간 초과 - ESC 키로 처리하고 잘린 시퀀스는 버림
+            push_key(KEY_ESC);
+            pos = g_input_length;
+            break;
+        }
+        
+        push_key(key);
+        pos += used;
+    }
+    
+    // 해석하지 못한 나머지를 버퍼 앞으로 이동
+    if (pos > 0) {
+        memmove(g_input_buffer, g_input_buffer + pos, g_input_length - pos);
+        g_input_length -= pos;
+    }
+    
+    // 불완전한 시퀀스가 남기 시작한 시각 기록 (시간 초과 판정용)
+    if (g_input_length == 0) {
+        g_incomplete_since = 0;
+    } else if (g_incomplete_since == 0) {
+        g_incomplete_since = platform_get_time_ms();
+    }
 }
 
-void platform_set_console_size(int width, int height) {
-    // Unix에서는 터미널 창의 크기를 안정적으로 조정할 수 없음
-    // 이는 일반적으로 터미널 에뮬레이터에서 처리됨
-    (void)width;
-    (void)height;
+/**
+ * @brief 읽을 수 있는 입력을 한 번의 read로 모두 가져와 해석합니다
+ */
+static void pump_input(void) {
+    ssize_t count = read(STDIN_FILENO, g_input_buffer + g_input_length,
+                         INPUT_BUFFER_SIZE - g_input_length);
+    if (count > 0) {
+        g_input_length += (size_t)count;
+    }
+    
+    bool timed_out = g_incomplete_since != 0 &&
+                     platform_get_time_ms() - g_incomplete_since >= ESCAPE_TIMEOUT_MS;
+    decode_input(timed_out || g_input_length == INPUT_BUFFER_SIZE);
 }
 
 game_key_t platform_get_key_pressed(void) {
-    char ch;
-    if (read(STDIN_FILENO, &ch, 1) == 1) {
-        if (ch == 27) { // ESC 시퀀스
-            char seq[3];
-            if (read(STDIN_FILENO, &seq[0], 1) == 1 && seq[0] == '[') {
-                if (read(STDIN_FILENO, &seq[1], 1) == 1) {
-                    switch (seq[1]) {
-                        case 'A': return KEY_UP;
-                        case 'B': return KEY_DOWN;
-                        case 'C': return KEY_RIGHT;
-                        case 'D': return KEY_LEFT;
-                    }
-                }
-            }
-            return KEY_ESC;
-        } else {
-            switch (ch) {
-                case '\n': case '\r': return KEY_ENTER;
-                case ' ': return KEY_SPACE;
-                case 'w': case 'W': return KEY_W;
-                case 'a': case 'A': return KEY_A;
-                case 's': case 'S': return KEY_S;
-                case 'd': case 'D': return KEY_D;
-                case '1': return KEY_1;
-                case '2': return KEY_2;
-                case '3': return KEY_3;
-                case '4': return KEY_4;
-            }
-        }
+    if (g_key_head == g_key_tail) {
+        pump_input();
+    }
+    
+    if (g_key_head == g_key_tail) {
+        return KEY_NONE;
+    }
+    return g_key_queue[g_key_head++ % KEY_QUEUE_SIZE];
+}
+
+bool platform_wait_input(uint32_t timeout_ms) {
+    // 이미 해석된 키가 있으면 기다리지 않음
+    if (g_key_head != g_key_tail) return true;
+    
+    // 불완전한 ESC 시퀀스가 남아 있으면 시간 초과 시점까지만 대기
+    if (g_input_length > 0 && timeout_ms > ESCAPE_TIMEOUT_MS) {
+        timeout_ms = ESCAPE_TIMEOUT_MS;
+    }
+    
+    struct pollfd fds[2];
+    nfds_t count = 0;
+    
+    fds[count].fd = STDIN_FILENO;
+    fds[count].events = POLLIN;
+    count++;
+    
+    if (g_wake_read_fd >= 0) {
+        fds[count].fd = g_wake_read_fd;
+        fds[count].events = POLLIN;
+        count++;
+    }
+    
+    int poll_timeout = timeout_ms == PLATFORM_WAIT_FOREVER ? -1 :
+                       timeout_ms > INT32_MAX ? INT32_MAX : (int)timeout_ms;
+    int ready = poll(fds, count, poll_timeout);
+    if (ready <= 0) {
+        return false;  // 시간 초과 또는 시그널 (EINTR)
+    }
+    
+    if (count > 1 && (fds[1].revents & POLLIN)) {
+        drain_wake_fd();
     }
-    return KEY_NONE;
+    return (fds[0].revents & POLLIN) != 0;
+}
+
+void platform_wake(void) {
+    if (g_wake_write_fd < 0) return;
+    
+    // eventfd는 8바이트 카운터, 파이프는 아무 바이트나 쓰면 됨
+    uint64_t one = 1;
+    ssize_t written;
+    do {
+        written = write(g_wake_write_fd, &one, g_wake_write_fd == g_wake_read_fd ? sizeof(one) : 1);
+    } while (written < 0 && errno == EINTR);
 }
 
 bool platform_is_key_down(game_key_t key) {
@@ -148,16 +370,76 @@ void platform_sleep(uint32_t ms) {
 }
 
 uint64_t platform_get_time_ms(void) {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+    return platform_get_time_us() / 1000;
+}
+
+uint64_t platform_get_time_us(void) {
+    // 시스템 시각 변경에 영향받지 않는 단조 시계 사용
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+void platform_sleep_until_us(uint64_t deadline_us) {
+#ifdef __linux__
+    // 절대 시각으로 잠들어 깨어나는 지연이 다음 대기에 누적되지 않음
+    struct timespec deadline;
+    deadline.tv_sec = (time_t)(deadline_us / 1000000);
+    deadline.tv_nsec = (long)(deadline_us % 1000000) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+        // 시그널로 깨면 같은 절대 시각으로 다시 대기
+    }
+#else
+    // clock_nanosleep이 없는 플랫폼(macOS)은 남은 시간만큼 상대 대기
+    uint64_t now = platform_get_time_us();
+    if (deadline_us > now) {
+        uint64_t remaining = deadline_us - now;
+        struct timespec ts;
+        ts.tv_sec = (time_t)(remaining / 1000000);
+        ts.tv_nsec = (long)(remaining % 1000000) * 1000;
+        nanosleep(&ts, NULL);
+    }
+#endif
 }
 
 // 스레딩 작업
+
+/**
+ * @brief 스레드 실행 상태를 추적하기 위한 시작 정보
+ */
+typedef struct {
+    pthread_t thread;              // pthread 핸들
+    thread_func_t func;            // 실행할 함수
+    void* arg;                     // 함수 인자
+    volatile int32_t running;      // 실행 중 1, 종료 0, 분리됨 THREAD_DETACHED
+} unix_thread_t;
+
+#define THREAD_DETACHED 2
+
+/**
+ * @brief 사용자 함수를 실행하고 끝나면 실행 중 표시를 지웁니다
+ * 
+ * 이미 분리된 스레드라면 시작 정보를 직접 해제합니다.
+ */
+static void* thread_trampoline(void* param) {
+    unix_thread_t* thread = (unix_thread_t*)param;
+    void* result = thread->func(thread->arg);
+    if (platform_atomic_exchange(&thread->running, 0) == THREAD_DETACHED) {
+        free(thread);
+    }
+    return result;
+}
+
 thread_handle_t platform_create_thread(thread_func_t func, void* arg) {
     thread_handle_t handle = {0};
-    pthread_t* thread = malloc(sizeof(pthread_t));
-    if (thread && pthread_create(thread, NULL, func, arg) == 0) {
+    unix_thread_t* thread = malloc(sizeof(unix_thread_t));
+    if (!thread) return handle;
+    
+    thread->func = func;
+    thread->arg = arg;
+    thread->running = 1;
+    
+    if (pthread_create(&thread->thread, NULL, thread_trampoline, thread) == 0) {
         handle.handle = thread;
         handle.id = (uint32_t)(uintptr_t)thread;
     } else {
@@ -168,21 +450,63 @@ thread_handle_t platform_create_thread(thread_func_t func, void* arg) {
 
 void platform_join_thread(thread_handle_t thread) {
     if (thread.handle) {
-        pthread_join(*(pthread_t*)thread.handle, NULL);
+        pthread_join(((unix_thread_t*)thread.handle)->thread, NULL);
         free(thread.handle);
     }
 }
 
 void platform_detach_thread(thread_handle_t thread) {
-    if (thread.handle) {
-        pthread_detach(*(pthread_t*)thread.handle);
-        free(thread.handle);
+    unix_thread_t* unix_thread = (unix_thread_t*)thread.handle;
+    if (!unix_thread) return;
+    
+    pthread_detach(unix_thread->thread);
+    
+    // 이미 끝났으면 여기서 해제하고, 아직 실행 중이면 트램펄린이 끝날 때 해제
+    if (platform_atomic_exchange(&unix_thread->running, THREAD_DETACHED) == 0) {
+        free(unix_thread);
     }
 }
 
 bool platform_thread_running(thread_handle_t thread) {
-    // 이것은 단순화된 검사 - 실제로는 더 정교한 추적이 필요함
-    return thread.handle != NULL;
+    if (!thread.handle) return false;
+    return platform_atomic_load(&((unix_thread_t*)thread.handle)->running) != 0;
+}
+
+// 스레드 스케줄링 (호출한 스레드에 적용)
+bool platform_set_thread_affinity(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    // macOS는 스레드를 특정 CPU에 고정하는 API를 제공하지 않음
+    (void)cpu;
+    return false;
+#endif
+}
+
+bool platform_set_thread_priority(thread_priority_t priority) {
+    struct sched_param param;
+    memset(&param, 0, sizeof(param));
+
+    if (priority == THREAD_PRIO_REALTIME) {
+        // 가장 낮은 실시간 우선순위로도 일반 스레드보다 먼저 실행됨
+        param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 1;
+        return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+
+    if (pthread_setschedparam(pthread_self(), SCHED_OTHER, &param) != 0) {
+        return false;
+    }
+#ifdef __linux__
+    // Linux의 nice 값은 스레드 단위
+    int nice_value = priority == THREAD_PRIO_HIGH ? -10 : 0;
+    return setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), nice_value) == 0;
+#else
+    return priority == THREAD_PRIO_NORMAL;
+#endif
 }
 
 // 뮤텍스 작업
@@ -216,6 +540,613 @@ void platform_unlock_mutex(mutex_handle_t mutex) {
     }
 }
 
+// 조건 변수 작업
+cond_handle_t platform_create_cond(void) {
+    cond_handle_t handle = {0};
+    pthread_cond_t* cond = malloc(sizeof(pthread_cond_t));
+    if (!cond) return handle;
+    
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+#ifdef __linux__
+    // 시간 제한 대기가 시스템 시각 변경에 영향받지 않도록 단조 시계 사용
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+    if (pthread_cond_init(cond, &attr) == 0) {
+        handle.handle = cond;
+    } else {
+        free(cond);
+    }
+    pthread_condattr_destroy(&attr);
+    return handle;
+}
+
+void platform_destroy_cond(cond_handle_t cond) {
+    if (cond.handle) {
+        pthread_cond_destroy((pthread_cond_t*)cond.handle);
+        free(cond.handle);
+    }
+}
+
+void platform_cond_wait(cond_handle_t cond, mutex_handle_t mutex) {
+    if (cond.handle && mutex.handle) {
+        pthread_cond_wait((pthread_cond_t*)cond.handle, (pthread_mutex_t*)mutex.handle);
+    }
+}
+
+bool platform_cond_timed_wait(cond_handle_t cond, mutex_handle_t mutex, uint32_t timeout_ms) {
+    if (!cond.handle || !mutex.handle) return false;
+    
+    struct timespec deadline;
+#ifdef __linux__
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+#else
+    clock_gettime(CLOCK_REALTIME, &deadline);
+#endif
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    
+    return pthread_cond_timedwait((pthread_cond_t*)cond.handle,
+                                  (pthread_mutex_t*)mutex.handle, &deadline) == 0;
+}
+
+void platform_cond_signal(cond_handle_t cond) {
+    if (cond.handle) {
+        pthread_cond_signal((pthread_cond_t*)cond.handle);
+    }
+}
+
+void platform_cond_broadcast(cond_handle_t cond) {
+    if (cond.handle) {
+        pthread_cond_broadcast((pthread_cond_t*)cond.handle);
+    }
+}
+
+// 세마포어 작업 (macOS는 이름 없는 POSIX 세마포어를 지원하지 않아 뮤텍스+조건 변수로 구현)
+typedef struct {
+    pthread_mutex_t mutex;         // 카운트 보호용 뮤텍스
+    pthread_cond_t cond;           // 카운트 증가 알림
+    uint32_t count;                // 현재 카운트
+} unix_semaphore_t;
+
+semaphore_handle_t platform_create_semaphore(uint32_t initial_count) {
+    semaphore_handle_t handle = {0};
+    unix_semaphore_t* semaphore = malloc(sizeof(unix_semaphore_t));
+    if (!semaphore) return handle;
+    
+    if (pthread_mutex_init(&semaphore->mutex, NULL) != 0) {
+        free(semaphore);
+        return handle;
+    }
+    if (pthread_cond_init(&semaphore->cond, NULL) != 0) {
+        pthread_mutex_destroy(&semaphore->mutex);
+        free(semaphore);
+        return handle;
+    }
+    semaphore->count = initial_count;
+    handle.handle = semaphore;
+    return handle;
+}
+
+void platform_destroy_semaphore(semaphore_handle_t semaphore) {
+    unix_semaphore_t* sem = (unix_semaphore_t*)semaphore.handle;
+    if (sem) {
+        pthread_cond_destroy(&sem->cond);
+        pthread_mutex_destroy(&sem->mutex);
+        free(sem);
+    }
+}
+
+void platform_semaphore_wait(semaphore_handle_t semaphore) {
+    unix_semaphore_t* sem = (unix_semaphore_t*)semaphore.handle;
+    if (!sem) return;
+    
+    pthread_mutex_lock(&sem->mutex);
+    while (sem->count == 0) {
+        pthread_cond_wait(&sem->cond, &sem->mutex);
+    }
+    sem->count--;
+    pthread_mutex_unlock(&sem->mutex);
+}
+
+bool platform_semaphore_try_wait(semaphore_handle_t semaphore) {
+    unix_semaphore_t* sem = (unix_semaphore_t*)semaphore.handle;
+    if (!sem) return false;
+    
+    pthread_mutex_lock(&sem->mutex);
+    bool acquired = sem->count > 0;
+    if (acquired) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->mutex);
+    return acquired;
+}
+
+void platform_semaphore_post(semaphore_handle_t semaphore) {
+    unix_semaphore_t* sem = (unix_semaphore_t*)semaphore.handle;
+    if (!sem) return;
+    
+    pthread_mutex_lock(&sem->mutex);
+    sem->count++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->mutex);
+}
+
+// 원자적 연산 (GCC/Clang 내장 함수)
+int32_t platform_atomic_load(volatile int32_t* value) {
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+void platform_atomic_store(volatile int32_t* value, int32_t new_value) {
+    __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+}
+
+int32_t platform_atomic_exchange(volatile int32_t* value, int32_t new_value) {
+    return __atomic_exchange_n(value, new_value, __ATOMIC_ACQ_REL);
+}
+
+int32_t platform_atomic_fetch_add(volatile int32_t* value, int32_t delta) {
+    return __atomic_fetch_add(value, delta, __ATOMIC_ACQ_REL);
+}
+
+bool platform_atomic_compare_exchange(volatile int32_t* value, int32_t* expected, int32_t desired) {
+    return __atomic_compare_exchange_n(value, expected, desired, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+int64_t platform_atomic_load64(volatile int64_t* value) {
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+void platform_atomic_store64(volatile int64_t* value, int64_t new_value) {
+    __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+}
+
+int64_t platform_atomic_fetch_add64(volatile int64_t* value, int64_t delta) {
+    return __atomic_fetch_add(value, delta, __ATOMIC_ACQ_REL);
+}
+
+// 스레드 지역 저장소
+tls_key_t platform_tls_create(void) {
+    tls_key_t key = {0};
+    pthread_key_t* pkey = malloc(sizeof(pthread_key_t));
+    if (pkey && pthread_key_create(pkey, NULL) == 0) {
+        key.handle = pkey;
+    } else {
+        free(pkey);
+    }
+    return key;
+}
+
+void platform_tls_destroy(tls_key_t key) {
+    if (key.handle) {
+        pthread_key_delete(*(pthread_key_t*)key.handle);
+        free(key.handle);
+    }
+}
+
+void* platform_tls_get(tls_key_t key) {
+    return key.handle ? pthread_getspecific(*(pthread_key_t*)key.handle) : NULL;
+}
+
+void platform_tls_set(tls_key_t key, void* value) {
+    if (key.handle) {
+        pthread_setspecific(*(pthread_key_t*)key.handle, value);
+    }
+}
+
+// 시스템 정보
+int platform_cpu_count(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+// 파일 시스템
+bool platform_create_directory(const char* path) {
+    if (!path) return false;
+    return mkdir(path, 0755) == 0 || errno == EEXIST;
+}
+
+bool platform_map_file(const char* path, mapped_file_t* file) {
+    if (!path || !file) return false;
+    memset(file, 0, sizeof(*file));
+    
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    
+    void* data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // 매핑은 파일 디스크립터를 닫아도 유지됨
+    if (data == MAP_FAILED) return false;
+    
+    file->data = (const uint8_t*)data;
+    file->size = (size_t)info.st_size;
+    return true;
+}
+
+void platform_unmap_file(mapped_file_t* file) {
+    if (!file || !file->data) return;
+    munmap((void*)file->data, file->size);
+    file->data = NULL;
+    file->size = 0;
+}
+
+bool platform_list_directory(const char* path, dir_entry_func_t callback, void* user) {
+    if (!path || !callback) return false;
+    
+    DIR* dir = opendir(path);
+    if (!dir) return false;
+    
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;  // ".", ".." 및 숨김 파일
+        
+        char full_path[1024];
+        struct stat info;
+        snprintf(full_path, sizeof(full_path), "%s/%s", path, entry->d_name);
+        if (stat(full_path, &info) == 0 && S_ISREG(info.st_mode)) {
+            callback(entry->d_name, user);
+        }
+    }
+    closedir(dir);
+    return true;
+}
+
+// ========== 네트워크 ==========
+
+#ifdef MSG_NOSIGNAL
+#define NET_SEND_FLAGS MSG_NOSIGNAL  // 끊긴 연결에 써도 SIGPIPE로 죽지 않도록
+#else
+#define NET_SEND_FLAGS 0             // macOS는 소켓마다 SO_NOSIGPIPE 설정
+#endif
+
+/**
+ * @brief 소켓을 논블로킹으로 바꾸고 작은 메시지가 바로 나가도록 설정합니다
+ */
+static bool prepare_socket(int fd, bool tcp) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) return false;
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+    int one = 1;
+    if (tcp) {
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));  // 틱마다 보내는 작은 메시지
+    }
+#ifdef SO_NOSIGPIPE
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    return true;
+}
+
+/**
+ * @brief "unix:경로"를 유닉스 도메인 소켓 주소로 바꿉니다
+ */
+static bool parse_unix_address(const char* address, struct sockaddr_un* out) {
+    const char* path = address + 5;
+    if (strlen(path) >= sizeof(out->sun_path) || !*path) return false;
+    memset(out, 0, sizeof(*out));
+    out->sun_family = AF_UNIX;
+    strcpy(out->sun_path, path);
+    return true;
+}
+
+/**
+ * @brief "호스트:포트"를 주소 목록으로 바꿉니다 (호스트가 비었거나 *이면 모든 주소)
+ */
+static struct addrinfo* resolve_tcp_address(const char* address, bool passive) {
+    const char* colon = strrchr(address, ':');
+    if (!colon || !colon[1]) return NULL;
+
+    char host[256];
+    size_t host_length = (size_t)(colon - address);
+    if (host_length >= sizeof(host)) return NULL;
+    memcpy(host, address, host_length);
+    host[host_length] = '\0';
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+
+    bool any = host_length == 0 || strcmp(host, "*") == 0;
+    struct addrinfo* result = NULL;
+    if (getaddrinfo(any ? NULL : host, colon + 1, &hints, &result) != 0) return NULL;
+    return result;
+}
+
+int platform_net_listen(const char* address) {
+    if (!address) return -1;
+
+    if (strncmp(address, "unix:", 5) == 0) {
+        struct sockaddr_un addr;
+        if (!parse_unix_address(address, &addr)) return -1;
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        unlink(addr.sun_path);  // 이전 실행이 남긴 소켓 파일
+        if (!prepare_socket(fd, false) || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+            listen(fd, SOMAXCONN) < 0) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    struct addrinfo* list = resolve_tcp_address(address, true);
+    int fd = -1;
+    for (struct addrinfo* ai = list; ai && fd < 0; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (!prepare_socket(fd, false) || bind(fd, ai->ai_addr, ai->ai_addrlen) < 0 ||
+            listen(fd, SOMAXCONN) < 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    if (list) freeaddrinfo(list);
+    return fd;
+}
+
+int platform_net_accept(int listener) {
+    struct sockaddr_storage addr;
+    socklen_t length = sizeof(addr);
+    int fd = accept(listener, (struct sockaddr*)&addr, &length);
+    if (fd < 0) return -1;
+
+    if (!prepare_socket(fd, addr.ss_family != AF_UNIX)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int platform_net_connect(const char* address) {
+    if (!address) return -1;
+
+    if (strncmp(address, "unix:", 5) == 0) {
+        struct sockaddr_un addr;
+        if (!parse_unix_address(address, &addr)) return -1;
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (!prepare_socket(fd, false) ||
+            (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 && errno != EINPROGRESS && errno != EAGAIN)) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    struct addrinfo* list = resolve_tcp_address(address, false);
+    int fd = -1;
+    for (struct addrinfo* ai = list; ai && fd < 0; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+
+        if (!prepare_socket(fd, true) ||
+            (connect(fd, ai->ai_addr, ai->ai_addrlen) < 0 && errno != EINPROGRESS)) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    if (list) freeaddrinfo(list);
+    return fd;
+}
+
+long platform_net_send(int socket, const void* data, size_t size) {
+    ssize_t sent = send(socket, data, size, NET_SEND_FLAGS);
+    if (sent >= 0) return (long)sent;
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return 0;
+    return NET_ERROR;
+}
+
+long platform_net_recv(int socket, void* data, size_t size) {
+    ssize_t received = recv(socket, data, size, 0);
+    if (received >= 0) return (long)received;
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return NET_AGAIN;
+    return NET_ERROR;
+}
+
+void platform_net_close(int socket) {
+    if (socket >= 0) close(socket);
+}
+
+/**
+ * @brief 열 수 있는 파일 디스크립터 한도를 최대로 올립니다 (연결이 많은 서버용)
+ */
+static void raise_descriptor_limit(void) {
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+#ifdef __linux__
+
+/**
+ * @brief epoll 기반 이벤트 대기기 (수준 트리거)
+ */
+struct net_poller {
+    int epoll_fd;
+    struct epoll_event events[256];  // 한 번의 epoll_wait 결과
+};
+
+static uint32_t to_epoll_events(int events) {
+    uint32_t result = 0;
+    if (events & NET_EVENT_READ) result |= EPOLLIN;
+    if (events & NET_EVENT_WRITE) result |= EPOLLOUT;
+    return result;
+}
+
+net_poller_t* platform_poller_create(void) {
+    net_poller_t* poller = malloc(sizeof(net_poller_t));
+    if (!poller) return NULL;
+
+    poller->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (poller->epoll_fd < 0) {
+        free(poller);
+        return NULL;
+    }
+    raise_descriptor_limit();
+    return poller;
+}
+
+void platform_poller_destroy(net_poller_t* poller) {
+    if (!poller) return;
+    close(poller->epoll_fd);
+    free(poller);
+}
+
+bool platform_poller_add(net_poller_t* poller, int socket, int events, void* user) {
+    struct epoll_event event;
+    event.events = to_epoll_events(events);
+    event.data.ptr = user;
+    return epoll_ctl(poller->epoll_fd, EPOLL_CTL_ADD, socket, &event) == 0;
+}
+
+bool platform_poller_modify(net_poller_t* poller, int socket, int events, void* user) {
+    struct epoll_event event;
+    event.events = to_epoll_events(events);
+    event.data.ptr = user;
+    return epoll_ctl(poller->epoll_fd, EPOLL_CTL_MOD, socket, &event) == 0;
+}
+
+void platform_poller_remove(net_poller_t* poller, int socket) {
+    struct epoll_event unused;  // 오래된 커널은 NULL을 받지 않음
+    epoll_ctl(poller->epoll_fd, EPOLL_CTL_DEL, socket, &unused);
+}
+
+int platform_poller_wait(net_poller_t* poller, net_event_t* events, int max_events, int timeout_ms) {
+    int capacity = (int)(sizeof(poller->events) / sizeof(poller->events[0]));
+    if (max_events > capacity) max_events = capacity;
+
+    int count = epoll_wait(poller->epoll_fd, poller->events, max_events, timeout_ms);
+    if (count < 0) return errno == EINTR ? 0 : -1;
+
+    for (int i = 0; i < count; i++) {
+        uint32_t ready = poller->events[i].events;
+        events[i].user = poller->events[i].data.ptr;
+        events[i].events = ((ready & EPOLLIN) ? NET_EVENT_READ : 0) |
+                           ((ready & EPOLLOUT) ? NET_EVENT_WRITE : 0) |
+                           ((ready & (EPOLLHUP | EPOLLERR)) ? NET_EVENT_HANGUP : 0);
+    }
+    return count;
+}
+
+#else
+
+/**
+ * @brief poll 기반 이벤트 대기기 (epoll이 없는 유닉스용, 등록 순서 배열)
+ */
+struct net_poller {
+    struct pollfd* fds;
+    void** users;
+    int count;
+    int capacity;
+    int next;                      // 다음 대기에서 먼저 살펴볼 위치 (공평하게 돌아가며)
+};
+
+static short to_poll_events(int events) {
+    short result = 0;
+    if (events & NET_EVENT_READ) result |= POLLIN;
+    if (events & NET_EVENT_WRITE) result |= POLLOUT;
+    return result;
+}
+
+static int find_poll_slot(const net_poller_t* poller, int socket) {
+    for (int i = 0; i < poller->count; i++) {
+        if (poller->fds[i].fd == socket) return i;
+    }
+    return -1;
+}
+
+net_poller_t* platform_poller_create(void) {
+    net_poller_t* poller = calloc(1, sizeof(net_poller_t));
+    if (poller) raise_descriptor_limit();
+    return poller;
+}
+
+void platform_poller_destroy(net_poller_t* poller) {
+    if (!poller) return;
+    free(poller->fds);
+    free(poller->users);
+    free(poller);
+}
+
+bool platform_poller_add(net_poller_t* poller, int socket, int events, void* user) {
+    if (poller->count == poller->capacity) {
+        int capacity = poller->capacity ? poller->capacity * 2 : 64;
+        struct pollfd* fds = realloc(poller->fds, (size_t)capacity * sizeof(struct pollfd));
+        if (!fds) return false;
+        poller->fds = fds;
+        void** users = realloc(poller->users, (size_t)capacity * sizeof(void*));
+        if (!users) return false;
+        poller->users = users;
+        poller->capacity = capacity;
+    }
+
+    poller->fds[poller->count].fd = socket;
+    poller->fds[poller->count].events = to_poll_events(events);
+    poller->fds[poller->count].revents = 0;
+    poller->users[poller->count] = user;
+    poller->count++;
+    return true;
+}
+
+bool platform_poller_modify(net_poller_t* poller, int socket, int events, void* user) {
+    int slot = find_poll_slot(poller, socket);
+    if (slot < 0) return false;
+    poller->fds[slot].events = to_poll_events(events);
+    poller->users[slot] = user;
+    return true;
+}
+
+void platform_poller_remove(net_poller_t* poller, int socket) {
+    int slot = find_poll_slot(poller, socket);
+    if (slot < 0) return;
+    poller->count--;
+    poller->fds[slot] = poller->fds[poller->count];
+    poller->users[slot] = poller->users[poller->count];
+}
+
+int platform_poller_wait(net_poller_t* poller, net_event_t* events, int max_events, int timeout_ms) {
+    int ready = poll(poller->fds, (nfds_t)poller->count, timeout_ms);
+    if (ready < 0) return errno == EINTR ? 0 : -1;
+
+    int found = 0;
+    for (int n = 0; n < poller->count && found < max_events && found < ready; n++) {
+        int i = (poller->next + n) % poller->count;
+        short revents = poller->fds[i].revents;
+        if (!revents) continue;
+
+        events[found].user = poller->users[i];
+        events[found].events = ((revents & POLLIN) ? NET_EVENT_READ : 0) |
+                               ((revents & POLLOUT) ? NET_EVENT_WRITE : 0) |
+                               ((revents & (POLLHUP | POLLERR | POLLNVAL)) ? NET_EVENT_HANGUP : 0);
+        found++;
+    }
+    if (poller->count > 0) {
+        poller->next = (poller->next + 1) % poller->count;
+    }
+    return found;
+}
+
+#endif // __linux__
+
 // 유틸리티 함수
 int platform_random(int min, int max) {
     return min + rand() % (max - min + 1);
@@ -225,9 +1156,9 @@ void platform_seed_random(uint32_t seed) {
     srand(seed);
 }
 
-// Windows 전용 더블 버퍼링 함수 (Unix에서는 빈 구현)
+// 가상 화면의 변경분만 한 번에 출력
 void platform_present_buffer(void) {
-    // Unix/Linux에서는 터미널이 자체적으로 버퍼링을 처리함
+    screen_flush_ansi(terminal_write);
     fflush(stdout);
 }
 
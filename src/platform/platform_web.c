@@ -1,4 +1,5 @@
 #include "platform.h"
+#include "screen.h"
 
 #ifdef PLATFORM_WEB
 
@@ -8,15 +9,9 @@
 #include <stdlib.h>
 #include <time.h>
 #include <string.h>
-
-// 웹용 가상 콘솔 시뮬레이션
-#define SCREEN_WIDTH 120
-#define SCREEN_HEIGHT 50
-static char g_screen_buffer[SCREEN_HEIGHT][SCREEN_WIDTH + 1];
-static color_t g_color_buffer[SCREEN_HEIGHT][SCREEN_WIDTH];
-static int g_cursor_x = 0, g_cursor_y = 0;
-static color_t g_current_color = COLOR_WHITE;
-static bool g_screen_dirty = false;
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
 
 // 키보드 입력 상태
 static game_key_t g_last_key = KEY_NONE;
@@ -29,14 +24,8 @@ EM_BOOL keyup_callback(int eventType, const EmscriptenKeyboardEvent *e, void *us
 bool platform_init(void) {
     printf("웹 플랫폼 초기화 시작...\n");
     
-    // 화면 버퍼 초기화 - UTF-8 호환
-    for (int y = 0; y < SCREEN_HEIGHT; y++) {
-        for (int x = 0; x < SCREEN_WIDTH; x++) {
-            g_screen_buffer[y][x] = ' ';
-            g_color_buffer[y][x] = COLOR_WHITE;
-        }
-        g_screen_buffer[y][SCREEN_WIDTH] = '\0'; // null terminator
-    }
+    // 가상 화면 초기화 (공용 합성기)
+    screen_init();
     
     printf("화면 버퍼 초기화 완료\n");
     
@@ -81,75 +70,6 @@ void platform_cleanup(void) {
     // 웹에서는 정리할 내용이 없음
 }
 
-void platform_clear_screen(void) {
-    for (int y = 0; y < SCREEN_HEIGHT; y++) {
-        for (int x = 0; x < SCREEN_WIDTH; x++) {
-            g_screen_buffer[y][x] = ' ';
-            g_color_buffer[y][x] = COLOR_BLACK;
-        }
-    }
-    g_cursor_x = g_cursor_y = 0;
-    g_screen_dirty = true;
-    
-    // HTML 출력 영역도 지우기
-    EM_ASM({
-        var output = document.getElementById('output');
-        if (output) {
-            output.textContent = '';
-        }
-    });
-}
-
-void platform_goto_xy(int x, int y) {
-    if (x >= 0 && x < SCREEN_WIDTH && y >= 0 && y < SCREEN_HEIGHT) {
-        g_cursor_x = x;
-        g_cursor_y = y;
-    }
-}
-
-void platform_set_color(color_t color) {
-    g_current_color = color;
-}
-
-void platform_reset_color(void) {
-    g_current_color = COLOR_WHITE;
-}
-
-void platform_print(const char* text) {
-    if (!text) return;
-    
-    int len = strlen(text);
-    for (int i = 0; i < len && g_cursor_x < SCREEN_WIDTH && g_cursor_y < SCREEN_HEIGHT; i++) {
-        char ch = text[i];
-        if (ch == '\n') {
-            g_cursor_x = 0;
-            g_cursor_y++;
-            if (g_cursor_y >= SCREEN_HEIGHT) break;
-        } else if (ch == '\r') {
-            g_cursor_x = 0;
-        } else {
-            // 모든 문자를 허용 (한글, 특수문자, 이모지 포함)
-            g_screen_buffer[g_cursor_y][g_cursor_x] = ch;
-            g_color_buffer[g_cursor_y][g_cursor_x] = g_current_color;
-            g_cursor_x++;
-            if (g_cursor_x >= SCREEN_WIDTH) {
-                g_cursor_x = 0;
-                g_cursor_y++;
-                if (g_cursor_y >= SCREEN_HEIGHT) break;
-            }
-        }
-    }
-    g_screen_dirty = true;
-    
-    // 브라우저 콘솔에도 출력 (디버깅용)
-    printf("%s", text);
-}
-
-void platform_print_at(int x, int y, const char* text) {
-    platform_goto_xy(x, y);
-    platform_print(text);
-}
-
 void platform_hide_cursor(void) {
     // 웹에서는 적용 불가
 }
@@ -228,6 +148,16 @@ bool platform_is_key_down(game_key_t key) {
     return false;
 }
 
+bool platform_wait_input(uint32_t timeout_ms) {
+    // 브라우저는 메인 루프 콜백 방식이라 대기하지 않고 현재 입력 여부만 반환
+    (void)timeout_ms;
+    return g_last_key != KEY_NONE;
+}
+
+void platform_wake(void) {
+    // 단일 스레드 웹에서는 깨울 대기가 없음
+}
+
 void platform_sleep(uint32_t ms) {
     // 비동기 슬립 (브라우저에서 차단 방지)
     emscripten_sleep(ms);
@@ -237,6 +167,18 @@ uint64_t platform_get_time_ms(void) {
     return (uint64_t)emscripten_get_now();
 }
 
+uint64_t platform_get_time_us(void) {
+    // performance.now() 기반 단조 시계 (소수점 이하 밀리초 포함)
+    return (uint64_t)(emscripten_get_now() * 1000.0);
+}
+
+void platform_sleep_until_us(uint64_t deadline_us) {
+    uint64_t now = platform_get_time_us();
+    if (deadline_us > now) {
+        emscripten_sleep((unsigned int)((deadline_us - now) / 1000));
+    }
+}
+
 // 스레딩 작업 (웹용 더미 구현)
 thread_handle_t platform_create_thread(thread_func_t func, void* arg) {
     thread_handle_t handle = {0};
@@ -257,6 +199,16 @@ bool platform_thread_running(thread_handle_t thread) {
     return false;
 }
 
+// 스레드 스케줄링 (브라우저가 관리하므로 변경 불가)
+bool platform_set_thread_affinity(int cpu) {
+    (void)cpu;
+    return false;
+}
+
+bool platform_set_thread_priority(thread_priority_t priority) {
+    return priority == THREAD_PRIO_NORMAL;
+}
+
 // 뮤텍스 작업 (단일 스레드 웹에서는 무동작)
 mutex_handle_t platform_create_mutex(void) {
     mutex_handle_t handle = {0};
@@ -275,79 +227,374 @@ void platform_unlock_mutex(mutex_handle_t mutex) {
     (void)mutex;
 }
 
-// 유틸리티 함수
-int platform_random(int min, int max) {
-    return min + rand() % (max - min + 1);
+// 조건 변수 작업 (단일 스레드 웹에서는 기다릴 상대가 없으므로 무동작)
+cond_handle_t platform_create_cond(void) {
+    cond_handle_t handle = {0};
+    return handle;
 }
 
-void platform_seed_random(uint32_t seed) {
-    srand(seed);
+void platform_destroy_cond(cond_handle_t cond) {
+    (void)cond;
 }
 
-// 웹 플랫폼용 화면 출력 함수 - UTF-8 완전 지원
-void platform_present_buffer(void) {
-    if (!g_screen_dirty) return;
+void platform_cond_wait(cond_handle_t cond, mutex_handle_t mutex) {
+    (void)cond;
+    (void)mutex;
+}
+
+bool platform_cond_timed_wait(cond_handle_t cond, mutex_handle_t mutex, uint32_t timeout_ms) {
+    (void)cond;
+    (void)mutex;
+    (void)timeout_ms;
+    return false;
+}
+
+void platform_cond_signal(cond_handle_t cond) {
+    (void)cond;
+}
+
+void platform_cond_broadcast(cond_handle_t cond) {
+    (void)cond;
+}
+
+// 세마포어 작업 (카운트만 관리 - 막히는 대기는 단일 스레드에서 풀릴 수 없음)
+semaphore_handle_t platform_create_semaphore(uint32_t initial_count) {
+    semaphore_handle_t handle = {0};
+    uint32_t* count = malloc(sizeof(uint32_t));
+    if (count) {
+        *count = initial_count;
+        handle.handle = count;
+    }
+    return handle;
+}
+
+void platform_destroy_semaphore(semaphore_handle_t semaphore) {
+    free(semaphore.handle);
+}
+
+void platform_semaphore_wait(semaphore_handle_t semaphore) {
+    platform_semaphore_try_wait(semaphore);
+}
+
+bool platform_semaphore_try_wait(semaphore_handle_t semaphore) {
+    uint32_t* count = (uint32_t*)semaphore.handle;
+    if (!count || *count == 0) return false;
+    (*count)--;
+    return true;
+}
+
+void platform_semaphore_post(semaphore_handle_t semaphore) {
+    uint32_t* count = (uint32_t*)semaphore.handle;
+    if (count) (*count)++;
+}
+
+// 원자적 연산 (단일 스레드 웹에서는 일반 읽기/쓰기)
+int32_t platform_atomic_load(volatile int32_t* value) {
+    return *value;
+}
+
+void platform_atomic_store(volatile int32_t* value, int32_t new_value) {
+    *value = new_value;
+}
+
+int32_t platform_atomic_exchange(volatile int32_t* value, int32_t new_value) {
+    int32_t old_value = *value;
+    *value = new_value;
+    return old_value;
+}
+
+int32_t platform_atomic_fetch_add(volatile int32_t* value, int32_t delta) {
+    int32_t old_value = *value;
+    *value = old_value + delta;
+    return old_value;
+}
+
+bool platform_atomic_compare_exchange(volatile int32_t* value, int32_t* expected, int32_t desired) {
+    if (*value == *expected) {
+        *value = desired;
+        return true;
+    }
+    *expected = *value;
+    return false;
+}
+
+int64_t platform_atomic_load64(volatile int64_t* value) {
+    return *value;
+}
+
+void platform_atomic_store64(volatile int64_t* value, int64_t new_value) {
+    *value = new_value;
+}
+
+int64_t platform_atomic_fetch_add64(volatile int64_t* value, int64_t delta) {
+    int64_t old_value = *value;
+    *value = old_value + delta;
+    return old_value;
+}
+
+// 스레드 지역 저장소 (스레드가 하나뿐이므로 키가 곧 저장 공간)
+tls_key_t platform_tls_create(void) {
+    tls_key_t key = {0};
+    key.handle = calloc(1, sizeof(void*));
+    return key;
+}
+
+void platform_tls_destroy(tls_key_t key) {
+    free(key.handle);
+}
+
+void* platform_tls_get(tls_key_t key) {
+    return key.handle ? *(void**)key.handle : NULL;
+}
+
+void platform_tls_set(tls_key_t key, void* value) {
+    if (key.handle) {
+        *(void**)key.handle = value;
+    }
+}
+
+// 시스템 정보
+int platform_cpu_count(void) {
+    return 1;  // 웹 빌드는 스레드를 사용하지 않음
+}
+
+// 파일 시스템
+bool platform_create_directory(const char* path) {
+    if (!path) return false;
+    // Emscripten 가상 파일 시스템 (MEMFS)
+    return mkdir(path, 0755) == 0 || errno == EEXIST;
+}
+
+bool platform_map_file(const char* path, mapped_file_t* file) {
+    if (!path || !file) return false;
+    memset(file, 0, sizeof(*file));
     
-    // 전체 화면 텍스트를 하나의 문자열로 구성
-    static char full_screen_text[SCREEN_HEIGHT * (SCREEN_WIDTH + 10) + 1000];
-    full_screen_text[0] = '\0';
+    // 웹에는 mmap이 없으므로 전체를 메모리로 읽음
+    FILE* stream = fopen(path, "rb");
+    if (!stream) return false;
     
-    // 색상 정보도 함께 전송
-    strcat(full_screen_text, "<div style='font-family: monospace; line-height: 1.2; white-space: pre; color: #00ff00;'>");
+    fseek(stream, 0, SEEK_END);
+    long size = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
     
-    for (int y = 0; y < SCREEN_HEIGHT; y++) {
-        // 각 라인을 null-terminated 문자열로 만들기
-        char line[SCREEN_WIDTH + 1];
-        memcpy(line, g_screen_buffer[y], SCREEN_WIDTH);
-        line[SCREEN_WIDTH] = '\0';
+    uint8_t* data = size > 0 ? malloc((size_t)size) : NULL;
+    if (!data || fread(data, 1, (size_t)size, stream) != (size_t)size) {
+        free(data);
+        fclose(stream);
+        return false;
+    }
+    fclose(stream);
+    
+    file->data = data;
+    file->size = (size_t)size;
+    return true;
+}
+
+void platform_unmap_file(mapped_file_t* file) {
+    if (!file || !file->data) return;
+    free((void*)file->data);
+    file->data = NULL;
+    file->size = 0;
+}
+
+bool platform_list_directory(const char* path, dir_entry_func_t callback, void* user) {
+    if (!path || !callback) return false;
+    
+    // Emscripten 가상 파일 시스템 (MEMFS)
+    DIR* dir = opendir(path);
+    if (!dir) return false;
+    
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;  // ".", ".." 및 숨김 파일
         
-        // 라인 끝의 공백 제거
-        int end = SCREEN_WIDTH - 1;
-        while (end >= 0 && line[end] == ' ') {
-            line[end] = '\0';
-            end--;
+        char full_path[1024];
+        struct stat info;
+        snprintf(full_path, sizeof(full_path), "%s/%s", path, entry->d_name);
+        if (stat(full_path, &info) == 0 && S_ISREG(info.st_mode)) {
+            callback(entry->d_name, user);
         }
+    }
+    closedir(dir);
+    return true;
+}
+
+// 네트워크 (브라우저에서는 원시 소켓을 쓸 수 없음)
+int platform_net_listen(const char* address) {
+    (void)address;
+    return -1;
+}
+
+int platform_net_accept(int listener) {
+    (void)listener;
+    return -1;
+}
+
+int platform_net_connect(const char* address) {
+    (void)address;
+    return -1;
+}
+
+long platform_net_send(int socket, const void* data, size_t size) {
+    (void)socket;
+    (void)data;
+    (void)size;
+    return NET_ERROR;
+}
+
+long platform_net_recv(int socket, void* data, size_t size) {
+    (void)socket;
+    (void)data;
+    (void)size;
+    return NET_ERROR;
+}
+
+void platform_net_close(int socket) {
+    (void)socket;
+}
+
+net_poller_t* platform_poller_create(void) {
+    return NULL;
+}
+
+void platform_poller_destroy(net_poller_t* poller) {
+    (void)poller;
+}
+
+bool platform_poller_add(net_poller_t* poller, int socket, int events, void* user) {
+    (void)poller;
+    (void)socket;
+    (void)events;
+    (void)user;
+    return false;
+}
+
+bool platform_poller_modify(net_poller_t* poller, int socket, int events, void* user) {
+    (void)poller;
+    (void)socket;
+    (void)events;
+    (void)user;
+    return false;
+}
+
+void platform_poller_remove(net_poller_t* poller, int socket) {
+    (void)poller;
+    (void)socket;
+}
+
+int platform_poller_wait(net_poller_t* poller, net_event_t* events, int max_events, int timeout_ms) {
+    (void)poller;
+    (void)events;
+    (void)max_events;
+    (void)timeout_ms;
+    return -1;
+}
+
+// 유틸리티 함수
+int platform_random(int min, int max) {
+    return min + rand() % (max - min + 1);
+}
+
+void platform_seed_random(uint32_t seed) {
+    srand(seed);
+}
+
+/**
+ * @brief 출력 영역에 줄 단위 DOM 요소가 준비되어 있는지 확인합니다
+ *
+ * 줄 요소를 새로 만들었다면(첫 출력이거나 페이지가 출력 영역을 덮어쓴 경우)
+ * 화면 전체를 다시 보내야 하므로 true를 반환합니다.
+ */
+static bool ensure_screen_rows(void) {
+    return EM_ASM_INT({
+        var output = document.getElementById('output');
+        if (!output) return 0;
+        if (Module.screenRows && Module.screenRows[0].isConnected) return 0;
         
-        // HTML 특수 문자 처리하면서 라인 추가
-        for (int i = 0; line[i] != '\0'; i++) {
-            char ch = line[i];
-            if (ch == '<') {
-                strcat(full_screen_text, "&lt;");
-            } else if (ch == '>') {
-                strcat(full_screen_text, "&gt;");
-            } else if (ch == '&') {
-                strcat(full_screen_text, "&amp;");
-            } else if (ch == ' ') {
-                strcat(full_screen_text, "&nbsp;");
-            } else {
-                // 문자를 그대로 추가 (UTF-8 지원)
-                char temp[2] = {ch, '\0'};
-                strcat(full_screen_text, temp);
-            }
+        var container = document.createElement('div');
+        container.style.cssText = 'font-family: monospace; line-height: 1.2; white-space: pre; color: #00ff00;';
+        var rows = [];
+        for (var y = 0; y < $0; y++) {
+            var row = document.createElement('div');
+            row.textContent = ' ';
+            container.appendChild(row);
+            rows.push(row);
         }
+        output.textContent = '';
+        output.appendChild(container);
+        Module.screenRows = rows;
+        return 1;
+    }, SCREEN_HEIGHT) != 0;
+}
+
+/**
+ * @brief 한 줄을 UTF-8 텍스트로 인코딩합니다 (선형 시간)
+ *
+ * 줄 요소는 textContent로 갱신하므로 HTML 이스케이프가 필요 없습니다.
+ *
+ * @return 기록한 바이트 수
+ */
+static size_t encode_row(const screen_cell_t* row, char* out) {
+    // 라인 끝의 공백 제거
+    int end = SCREEN_WIDTH;
+    while (end > 0 && row[end - 1].len == 0) {
+        end--;
+    }
+    
+    char* p = out;
+    for (int x = 0; x < end; x++) {
+        const screen_cell_t* cell = &row[x];
+        if (cell->flags & SCREEN_CELL_CONTINUATION) continue;  // 두 칸 글자의 둘째 칸
         
-        if (y < SCREEN_HEIGHT - 1) {
-            strcat(full_screen_text, "\n");
+        if (cell->len == 0) {
+            *p++ = ' ';
+        } else {
+            memcpy(p, cell->glyph, cell->len);
+            p += cell->len;
         }
     }
     
-    strcat(full_screen_text, "</div>");
+    // 빈 줄도 높이를 유지하도록 공백 하나는 남김
+    if (p == out) *p++ = ' ';
+    return (size_t)(p - out);
+}
+
+// 웹 플랫폼용 화면 출력 함수 - 바뀐 줄만 JavaScript로 전송
+void platform_present_buffer(void) {
+    if (ensure_screen_rows()) {
+        screen_invalidate();
+    }
+    
+    bool dirty_rows[SCREEN_HEIGHT];
+    int dirty_count = screen_collect_dirty_rows(dirty_rows);
+    if (dirty_count == 0) return;
+    
+    // 바뀐 줄들을 '\n'으로 이어 붙인 텍스트와 줄 번호 목록 (한 번의 JS 호출로 전달)
+    static char text[SCREEN_HEIGHT * (SCREEN_WIDTH * SCREEN_GLYPH_MAX + 1) + 1];
+    static int32_t row_indices[SCREEN_HEIGHT];
+    
+    char* p = text;
+    int count = 0;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        if (!dirty_rows[y]) continue;
+        if (count > 0) *p++ = '\n';
+        p += encode_row(screen_row(y), p);
+        row_indices[count++] = y;
+    }
+    *p = '\0';
     
-    // JavaScript로 UTF-8 텍스트 전송
     EM_ASM({
         try {
-            var output = document.getElementById('output');
-            if (output) {
-                // UTF-8 문자열을 그대로 사용
-                var text = UTF8ToString($0);
-                output.innerHTML = text;
+            var rows = Module.screenRows;
+            if (!rows) return;
+            var lines = UTF8ToString($0).split('\n');
+            for (var i = 0; i < $2; i++) {
+                rows[HEAP32[($1 >> 2) + i]].textContent = lines[i];
             }
         } catch (e) {
             console.error('화면 업데이트 오류:', e);
         }
-    }, full_screen_text);
-    
-    g_screen_dirty = false;
+    }, text, row_indices, count);
 }
 
 #endif // PLATFORM_WEB
\ No newline at end of file
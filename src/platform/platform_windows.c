@@ -1,26 +1,30 @@
 #include "platform.h"
+#include "screen.h"
+#include "capture.h"
 
 #ifdef PLATFORM_WINDOWS
 
 #include <windows.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <conio.h>
 #include <io.h>
 #include <fcntl.h>
+#include <limits.h>
 
 static HANDLE g_console_handle = NULL;
 static HANDLE g_input_handle = NULL;
-static HANDLE g_back_buffer = NULL;  // 더블 버퍼링용 백 버퍼
-static COORD g_buffer_size = {0, 0};
-static SMALL_RECT g_write_region = {0, 0, 0, 0};
-static bool g_double_buffering_enabled = false;
-
-// 화면 변경 추적을 위한 버퍼
-static char** g_screen_text_buffer = NULL;
-static WORD* g_screen_attr_buffer = NULL;
-static bool g_screen_initialized = false;
+static HANDLE g_wake_event = NULL;   // platform_wait_input을 깨우기 위한 자동 리셋 이벤트
+
+/**
+ * @brief 터미널로 바이트를 보냅니다 (캡처 중이면 녹화에도 추가)
+ */
+static void terminal_write(const char* data, size_t len) {
+    fwrite(data, 1, len, stdout);
+    capture_output(data, len);
+}
 
 bool platform_init(void) {
     g_console_handle = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -41,181 +45,33 @@ bool platform_init(void) {
         SetConsoleMode(g_console_handle, console_mode);
     }
 
-    // 화면 버퍼 크기 가져오기
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    if (GetConsoleScreenBufferInfo(g_console_handle, &csbi)) {
-        g_buffer_size.X = csbi.dwSize.X;
-        g_buffer_size.Y = csbi.dwSize.Y;
-
-        // 텍스트 추적 버퍼 할당
-        g_screen_text_buffer = (char**)malloc(g_buffer_size.Y * sizeof(char*));
-        g_screen_attr_buffer = (WORD*)malloc(g_buffer_size.X * g_buffer_size.Y * sizeof(WORD));
-
-        if (g_screen_text_buffer && g_screen_attr_buffer) {
-            for (int y = 0; y < g_buffer_size.Y; y++) {
-                g_screen_text_buffer[y] = (char*)malloc(g_buffer_size.X * 4 + 1); // UTF-8용 충분한 공간
-                if (g_screen_text_buffer[y]) {
-                    memset(g_screen_text_buffer[y], 0, g_buffer_size.X * 4 + 1);
-                }
-            }
-
-            // 속성 버퍼 초기화
-            WORD default_attr = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE;
-            for (int i = 0; i < g_buffer_size.X * g_buffer_size.Y; i++) {
-                g_screen_attr_buffer[i] = default_attr;
-            }
-
-            g_screen_initialized = true;
-        }
-    }
+    // 다른 스레드에서 입력 대기를 깨우기 위한 이벤트
+    g_wake_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    // 화면 변경 추적은 공용 합성기(screen.c)가 담당
+    screen_init();
     
     srand((unsigned int)time(NULL));
     return true;
 }
 
 void platform_cleanup(void) {
-    platform_reset_color();
+    terminal_write("\033[0m", 4);
     platform_show_cursor();
-
-    // 화면 추적 버퍼 해제
-    if (g_screen_text_buffer) {
-        for (int y = 0; y < g_buffer_size.Y; y++) {
-            if (g_screen_text_buffer[y]) {
-                free(g_screen_text_buffer[y]);
-            }
-        }
-        free(g_screen_text_buffer);
-        g_screen_text_buffer = NULL;
-    }
-
-    if (g_screen_attr_buffer) {
-        free(g_screen_attr_buffer);
-        g_screen_attr_buffer = NULL;
-    }
-
-    g_screen_initialized = false;
-}
-
-void platform_clear_screen(void) {
-    if (g_screen_initialized) {
-        // 화면 추적 버퍼도 클리어
-        for (int y = 0; y < g_buffer_size.Y; y++) {
-            if (g_screen_text_buffer[y]) {
-                memset(g_screen_text_buffer[y], 0, g_buffer_size.X * 4 + 1);
-            }
-        }
-
-        WORD default_attr = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE;
-        for (int i = 0; i < g_buffer_size.X * g_buffer_size.Y; i++) {
-            g_screen_attr_buffer[i] = default_attr;
-        }
-    }
-
-    // 한 번만 화면 클리어
-    printf("\033[2J\033[H");
-    fflush(stdout);
-}
-
-static COORD g_current_pos = {0, 0};
-static WORD g_current_attr = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE;
-
-void platform_goto_xy(int x, int y) {
-    g_current_pos.X = (SHORT)x;
-    g_current_pos.Y = (SHORT)y;
-}
-
-void platform_set_color(color_t color) {
-    g_current_attr = (WORD)color;
-}
-
-void platform_reset_color(void) {
-    g_current_attr = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE;
-    printf("\033[0m");
-    fflush(stdout);
-}
-
-void platform_print(const char* text) {
-    if (!text) return;
-
-    // 현재 위치가 유효한 범위 내인지 확인
-    if (g_current_pos.X < 0 || g_current_pos.X >= g_buffer_size.X ||
-        g_current_pos.Y < 0 || g_current_pos.Y >= g_buffer_size.Y) {
-        return;
-    }
-
-    if (g_screen_initialized && g_screen_text_buffer && g_screen_attr_buffer) {
-        // 현재 위치의 기존 내용과 비교
-        int buffer_index = g_current_pos.Y * g_buffer_size.X + g_current_pos.X;
-        bool content_changed = false;
-        bool attr_changed = false;
-
-        // 텍스트 변경 확인
-        char* current_line = g_screen_text_buffer[g_current_pos.Y];
-        int start_pos = g_current_pos.X * 4; // UTF-8을 위한 충분한 공간
-
-        if (strncmp(&current_line[start_pos], text, strlen(text)) != 0) {
-            content_changed = true;
-            // 새 텍스트 저장
-            strncpy(&current_line[start_pos], text, strlen(text));
-        }
-
-        // 속성 변경 확인
-        if (g_screen_attr_buffer[buffer_index] != g_current_attr) {
-            attr_changed = true;
-            g_screen_attr_buffer[buffer_index] = g_current_attr;
-        }
-
-        // 변경된 내용만 출력 (깜빡거림 최소화)
-        if (content_changed || attr_changed) {
-            printf("\033[%d;%dH", g_current_pos.Y + 1, g_current_pos.X + 1);
-
-            // 색상 설정
-            const char* color_codes[] = {
-                "\033[30m", "\033[34m", "\033[32m", "\033[36m",
-                "\033[31m", "\033[35m", "\033[33m", "\033[37m",
-                "\033[90m", "\033[94m", "\033[92m", "\033[96m",
-                "\033[91m", "\033[95m", "\033[93m", "\033[97m"
-            };
-
-            if (g_current_attr < 16) {
-                printf("%s", color_codes[g_current_attr]);
-            }
-            printf("%s", text);
-        }
-    } else {
-        // fallback: 직접 출력
-        printf("\033[%d;%dH", g_current_pos.Y + 1, g_current_pos.X + 1);
-
-        const char* color_codes[] = {
-            "\033[30m", "\033[34m", "\033[32m", "\033[36m",
-            "\033[31m", "\033[35m", "\033[33m", "\033[37m",
-            "\033[90m", "\033[94m", "\033[92m", "\033[96m",
-            "\033[91m", "\033[95m", "\033[93m", "\033[97m"
-        };
-
-        if (g_current_attr < 16) {
-            printf("%s", color_codes[g_current_attr]);
-        }
-
-        printf("%s", text);
+    
+    if (g_wake_event) {
+        CloseHandle(g_wake_event);
+        g_wake_event = NULL;
     }
-
-    // 커서 위치 업데이트
-    g_current_pos.X += strlen(text);
-}
-
-void platform_print_at(int x, int y, const char* text) {
-    platform_goto_xy(x, y);
-    platform_print(text);
 }
 
 void platform_hide_cursor(void) {
-    printf("\033[?25l");
+    terminal_write("\033[?25l", 6);
     fflush(stdout);
 }
 
 void platform_show_cursor(void) {
-    printf("\033[?25h");
+    terminal_write("\033[?25h", 6);
     fflush(stdout);
 }
 
@@ -227,18 +83,10 @@ void platform_set_console_size(int width, int height) {
     SetConsoleWindowInfo(g_console_handle, TRUE, &win);
 }
 
-// 모든 변경사항을 한 번에 출력 (깜빡거림 방지)
+// 가상 화면의 변경분만 한 번에 출력 (깜빡거림 방지)
 void platform_present_buffer(void) {
-    static bool first_present = true;
-
-    if (first_present) {
-        // 첫 번째 출력시에만 전체 화면 갱신
-        fflush(stdout);
-        first_present = false;
-    } else {
-        // 이후에는 버퍼링된 출력만 플러시
-        fflush(stdout);
-    }
+    screen_flush_ansi(terminal_write);
+    fflush(stdout);
 }
 
 game_key_t platform_get_key_pressed(void) {
@@ -271,6 +119,33 @@ game_key_t platform_get_key_pressed(void) {
     return KEY_NONE;
 }
 
+bool platform_wait_input(uint32_t timeout_ms) {
+    if (_kbhit()) return true;
+    
+    HANDLE handles[2] = {g_input_handle, g_wake_event};
+    DWORD count = g_wake_event ? 2 : 1;
+    
+    DWORD result = WaitForMultipleObjects(count, handles, FALSE,
+                                          timeout_ms == PLATFORM_WAIT_FOREVER ? INFINITE : timeout_ms);
+    if (result != WAIT_OBJECT_0) {
+        return false;  // 깨우기 이벤트 또는 시간 초과
+    }
+    
+    // 키 떼기, 포커스 등 문자 입력이 아닌 이벤트만 남아 있으면 핸들이 계속
+    // 신호 상태로 남으므로 버퍼를 비움 (읽을 문자가 없을 때만)
+    if (!_kbhit()) {
+        FlushConsoleInputBuffer(g_input_handle);
+        return false;
+    }
+    return true;
+}
+
+void platform_wake(void) {
+    if (g_wake_event) {
+        SetEvent(g_wake_event);
+    }
+}
+
 bool platform_is_key_down(game_key_t key) {
     int vk_key = 0;
     switch (key) {
@@ -295,7 +170,38 @@ void platform_sleep(uint32_t ms) {
 }
 
 uint64_t platform_get_time_ms(void) {
-    return GetTickCount64();
+    return platform_get_time_us() / 1000;
+}
+
+uint64_t platform_get_time_us(void) {
+    // 고해상도 성능 카운터 (단조 증가)
+    static LARGE_INTEGER frequency = {0};
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    
+    // 곱셈 오버플로를 피하기 위해 초 단위와 나머지를 나눠서 변환
+    uint64_t seconds = (uint64_t)(counter.QuadPart / frequency.QuadPart);
+    uint64_t remainder = (uint64_t)(counter.QuadPart % frequency.QuadPart);
+    return seconds * 1000000 + remainder * 1000000 / (uint64_t)frequency.QuadPart;
+}
+
+void platform_sleep_until_us(uint64_t deadline_us) {
+    // Sleep은 밀리초 단위로 늦게 깨므로 1ms 전까지만 자고 나머지는 양보하며 대기
+    for (;;) {
+        uint64_t now = platform_get_time_us();
+        if (now >= deadline_us) break;
+        
+        uint64_t remaining = deadline_us - now;
+        if (remaining > 2000) {
+            Sleep((DWORD)(remaining / 1000 - 1));
+        } else {
+            SwitchToThread();
+        }
+    }
 }
 
 // 스레딩 작업
@@ -325,31 +231,332 @@ bool platform_thread_running(thread_handle_t thread) {
     return exit_code == STILL_ACTIVE;
 }
 
-// 뮤텍스 작업
+// 스레드 스케줄링 (호출한 스레드에 적용)
+bool platform_set_thread_affinity(int cpu) {
+    if (cpu < 0 || cpu >= (int)(sizeof(DWORD_PTR) * 8)) return false;
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0;
+}
+
+bool platform_set_thread_priority(thread_priority_t priority) {
+    int level = THREAD_PRIORITY_NORMAL;
+    if (priority == THREAD_PRIO_HIGH) {
+        level = THREAD_PRIORITY_HIGHEST;
+    } else if (priority == THREAD_PRIO_REALTIME) {
+        level = THREAD_PRIORITY_TIME_CRITICAL;
+    }
+    return SetThreadPriority(GetCurrentThread(), level) != 0;
+}
+
+// 뮤텍스 작업 (조건 변수와 함께 쓰기 위해 CRITICAL_SECTION 사용)
 mutex_handle_t platform_create_mutex(void) {
     mutex_handle_t handle = {0};
-    handle.handle = CreateMutex(NULL, FALSE, NULL);
+    CRITICAL_SECTION* section = malloc(sizeof(CRITICAL_SECTION));
+    if (section) {
+        InitializeCriticalSection(section);
+        handle.handle = section;
+    }
     return handle;
 }
 
 void platform_destroy_mutex(mutex_handle_t mutex) {
     if (mutex.handle) {
-        CloseHandle(mutex.handle);
+        DeleteCriticalSection((CRITICAL_SECTION*)mutex.handle);
+        free(mutex.handle);
     }
 }
 
 void platform_lock_mutex(mutex_handle_t mutex) {
     if (mutex.handle) {
-        WaitForSingleObject(mutex.handle, INFINITE);
+        EnterCriticalSection((CRITICAL_SECTION*)mutex.handle);
     }
 }
 
 void platform_unlock_mutex(mutex_handle_t mutex) {
     if (mutex.handle) {
-        ReleaseMutex(mutex.handle);
+        LeaveCriticalSection((CRITICAL_SECTION*)mutex.handle);
+    }
+}
+
+// 조건 변수 작업
+cond_handle_t platform_create_cond(void) {
+    cond_handle_t handle = {0};
+    CONDITION_VARIABLE* cond = malloc(sizeof(CONDITION_VARIABLE));
+    if (cond) {
+        InitializeConditionVariable(cond);
+        handle.handle = cond;
+    }
+    return handle;
+}
+
+void platform_destroy_cond(cond_handle_t cond) {
+    // Windows 조건 변수는 별도 해제가 필요 없음
+    free(cond.handle);
+}
+
+void platform_cond_wait(cond_handle_t cond, mutex_handle_t mutex) {
+    if (cond.handle && mutex.handle) {
+        SleepConditionVariableCS((CONDITION_VARIABLE*)cond.handle, (CRITICAL_SECTION*)mutex.handle, INFINITE);
+    }
+}
+
+bool platform_cond_timed_wait(cond_handle_t cond, mutex_handle_t mutex, uint32_t timeout_ms) {
+    if (!cond.handle || !mutex.handle) return false;
+    return SleepConditionVariableCS((CONDITION_VARIABLE*)cond.handle,
+                                    (CRITICAL_SECTION*)mutex.handle, timeout_ms) != 0;
+}
+
+void platform_cond_signal(cond_handle_t cond) {
+    if (cond.handle) {
+        WakeConditionVariable((CONDITION_VARIABLE*)cond.handle);
+    }
+}
+
+void platform_cond_broadcast(cond_handle_t cond) {
+    if (cond.handle) {
+        WakeAllConditionVariable((CONDITION_VARIABLE*)cond.handle);
     }
 }
 
+// 세마포어 작업
+semaphore_handle_t platform_create_semaphore(uint32_t initial_count) {
+    semaphore_handle_t handle = {0};
+    handle.handle = CreateSemaphore(NULL, (LONG)initial_count, LONG_MAX, NULL);
+    return handle;
+}
+
+void platform_destroy_semaphore(semaphore_handle_t semaphore) {
+    if (semaphore.handle) {
+        CloseHandle(semaphore.handle);
+    }
+}
+
+void platform_semaphore_wait(semaphore_handle_t semaphore) {
+    if (semaphore.handle) {
+        WaitForSingleObject(semaphore.handle, INFINITE);
+    }
+}
+
+bool platform_semaphore_try_wait(semaphore_handle_t semaphore) {
+    return semaphore.handle && WaitForSingleObject(semaphore.handle, 0) == WAIT_OBJECT_0;
+}
+
+void platform_semaphore_post(semaphore_handle_t semaphore) {
+    if (semaphore.handle) {
+        ReleaseSemaphore(semaphore.handle, 1, NULL);
+    }
+}
+
+// 원자적 연산 (Interlocked 함수는 완전한 메모리 배리어를 포함)
+int32_t platform_atomic_load(volatile int32_t* value) {
+    return (int32_t)InterlockedCompareExchange((volatile LONG*)value, 0, 0);
+}
+
+void platform_atomic_store(volatile int32_t* value, int32_t new_value) {
+    InterlockedExchange((volatile LONG*)value, (LONG)new_value);
+}
+
+int32_t platform_atomic_exchange(volatile int32_t* value, int32_t new_value) {
+    return (int32_t)InterlockedExchange((volatile LONG*)value, (LONG)new_value);
+}
+
+int32_t platform_atomic_fetch_add(volatile int32_t* value, int32_t delta) {
+    return (int32_t)InterlockedExchangeAdd((volatile LONG*)value, (LONG)delta);
+}
+
+bool platform_atomic_compare_exchange(volatile int32_t* value, int32_t* expected, int32_t desired) {
+    LONG previous = InterlockedCompareExchange((volatile LONG*)value, (LONG)desired, (LONG)*expected);
+    if (previous == (LONG)*expected) {
+        return true;
+    }
+    *expected = (int32_t)previous;
+    return false;
+}
+
+int64_t platform_atomic_load64(volatile int64_t* value) {
+    return (int64_t)InterlockedCompareExchange64((volatile LONG64*)value, 0, 0);
+}
+
+void platform_atomic_store64(volatile int64_t* value, int64_t new_value) {
+    InterlockedExchange64((volatile LONG64*)value, (LONG64)new_value);
+}
+
+int64_t platform_atomic_fetch_add64(volatile int64_t* value, int64_t delta) {
+    return (int64_t)InterlockedExchangeAdd64((volatile LONG64*)value, (LONG64)delta);
+}
+
+// 스레드 지역 저장소
+tls_key_t platform_tls_create(void) {
+    tls_key_t key = {0};
+    DWORD index = TlsAlloc();
+    if (index != TLS_OUT_OF_INDEXES) {
+        // 0도 유효한 인덱스이므로 1을 더해 저장
+        key.handle = (void*)(uintptr_t)(index + 1);
+    }
+    return key;
+}
+
+void platform_tls_destroy(tls_key_t key) {
+    if (key.handle) {
+        TlsFree((DWORD)((uintptr_t)key.handle - 1));
+    }
+}
+
+void* platform_tls_get(tls_key_t key) {
+    return key.handle ? TlsGetValue((DWORD)((uintptr_t)key.handle - 1)) : NULL;
+}
+
+void platform_tls_set(tls_key_t key, void* value) {
+    if (key.handle) {
+        TlsSetValue((DWORD)((uintptr_t)key.handle - 1), value);
+    }
+}
+
+// 시스템 정보
+int platform_cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+// 파일 시스템
+bool platform_create_directory(const char* path) {
+    if (!path) return false;
+    return CreateDirectoryA(path, NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+bool platform_map_file(const char* path, mapped_file_t* file) {
+    if (!path || !file) return false;
+    memset(file, 0, sizeof(*file));
+    
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+    
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart <= 0) {
+        CloseHandle(handle);
+        return false;
+    }
+    
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);  // 매핑 객체가 파일을 계속 참조함
+    if (!mapping) return false;
+    
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        return false;
+    }
+    
+    file->data = (const uint8_t*)data;
+    file->size = (size_t)size.QuadPart;
+    file->handle = mapping;
+    return true;
+}
+
+void platform_unmap_file(mapped_file_t* file) {
+    if (!file || !file->data) return;
+    UnmapViewOfFile(file->data);
+    CloseHandle(file->handle);
+    file->data = NULL;
+    file->size = 0;
+    file->handle = NULL;
+}
+
+bool platform_list_directory(const char* path, dir_entry_func_t callback, void* user) {
+    if (!path || !callback) return false;
+    
+    char pattern[MAX_PATH];
+    snprintf(pattern, sizeof(pattern), "%s\\*", path);
+    
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileA(pattern, &data);
+    if (find == INVALID_HANDLE_VALUE) {
+        return GetLastError() == ERROR_FILE_NOT_FOUND;  // 빈 디렉터리
+    }
+    
+    do {
+        if (data.cFileName[0] == '.') continue;  // ".", ".." 및 숨김 파일
+        if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+            callback(data.cFileName, user);
+        }
+    } while (FindNextFileA(find, &data));
+    
+    FindClose(find);
+    return true;
+}
+
+// 네트워크 (아직 지원하지 않음 - 서버와 접속 도구는 유닉스 계열에서 실행)
+int platform_net_listen(const char* address) {
+    (void)address;
+    return -1;
+}
+
+int platform_net_accept(int listener) {
+    (void)listener;
+    return -1;
+}
+
+int platform_net_connect(const char* address) {
+    (void)address;
+    return -1;
+}
+
+long platform_net_send(int socket, const void* data, size_t size) {
+    (void)socket;
+    (void)data;
+    (void)size;
+    return NET_ERROR;
+}
+
+long platform_net_recv(int socket, void* data, size_t size) {
+    (void)socket;
+    (void)data;
+    (void)size;
+    return NET_ERROR;
+}
+
+void platform_net_close(int socket) {
+    (void)socket;
+}
+
+net_poller_t* platform_poller_create(void) {
+    return NULL;
+}
+
+void platform_poller_destroy(net_poller_t* poller) {
+    (void)poller;
+}
+
+bool platform_poller_add(net_poller_t* poller, int socket, int events, void* user) {
+    (void)poller;
+    (void)socket;
+    (void)events;
+    (void)user;
+    return false;
+}
+
+bool platform_poller_modify(net_poller_t* poller, int socket, int events, void* user) {
+    (void)poller;
+    (void)socket;
+    (void)events;
+    (void)user;
+    return false;
+}
+
+void platform_poller_remove(net_poller_t* poller, int socket) {
+    (void)poller;
+    (void)socket;
+}
+
+int platform_poller_wait(net_poller_t* poller, net_event_t* events, int max_events, int timeout_ms) {
+    (void)poller;
+    (void)events;
+    (void)max_events;
+    (void)timeout_ms;
+    return -1;
+}
+
 // 유틸리티 함수
 int platform_random(int min, int max) {
     return min + rand() % (max - min + 1);
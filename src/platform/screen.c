@@ -0,0 +1,439 @@
+#include "screen.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// 백 버퍼 (이번 프레임에 그린 내용)와 프론트 버퍼 (화면에 실제로 출력된 내용)
+static screen_cell_t g_back[SCREEN_HEIGHT][SCREEN_WIDTH];
+static screen_cell_t g_front[SCREEN_HEIGHT][SCREEN_WIDTH];
+
+// 그리기 커서와 색상
+static int g_cursor_x = 0, g_cursor_y = 0;
+static color_t g_current_color = COLOR_WHITE;
+
+// 화면 전체를 다시 그려야 하는지 (시작 시 터미널 내용을 알 수 없으므로 true)
+static bool g_full_redraw = true;
+
+// ANSI 전경색 코드
+static const char* const g_color_codes[16] = {
+    "\033[30m", "\033[34m", "\033[32m", "\033[36m",
+    "\033[31m", "\033[35m", "\033[33m", "\033[37m",
+    "\033[90m", "\033[94m", "\033[92m", "\033[96m",
+    "\033[91m", "\033[95m", "\033[93m", "\033[97m"
+};
+
+// 코드 포인트 범위 테이블
+typedef struct {
+    uint32_t first, last;
+} codepoint_range_t;
+
+// 폭이 0인 문자 (결합 문자, 이형 선택자, ZWJ 등)
+static const codepoint_range_t g_zero_width[] = {
+    {0x0300, 0x036F}, {0x200B, 0x200F}, {0x20D0, 0x20FF},
+    {0xFE00, 0xFE0F}, {0xE0100, 0xE01EF}
+};
+
+// 두 칸을 차지하는 문자 (한글, CJK, 기본 이모지 표현 문자)
+static const codepoint_range_t g_wide[] = {
+    {0x1100, 0x115F}, {0x231A, 0x231B}, {0x23E9, 0x23EC}, {0x23F0, 0x23F0},
+    {0x23F3, 0x23F3}, {0x25FD, 0x25FE}, {0x2614, 0x2615}, {0x2648, 0x2653},
+    {0x267F, 0x267F}, {0x2693, 0x2693}, {0x26A1, 0x26A1}, {0x26AA, 0x26AB},
+    {0x26BD, 0x26BE}, {0x26C4, 0x26C5}, {0x26CE, 0x26CE}, {0x26D4, 0x26D4},
+    {0x26EA, 0x26EA}, {0x26F2, 0x26F3}, {0x26F5, 0x26F5}, {0x26FA, 0x26FA},
+    {0x26FD, 0x26FD}, {0x2705, 0x2705}, {0x270A, 0x270B}, {0x2728, 0x2728},
+    {0x274C, 0x274C}, {0x274E, 0x274E}, {0x2753, 0x2755}, {0x2757, 0x2757},
+    {0x2795, 0x2797}, {0x27B0, 0x27B0}, {0x27BF, 0x27BF}, {0x2B1B, 0x2B1C},
+    {0x2B50, 0x2B50}, {0x2B55, 0x2B55}, {0x2E80, 0x303E}, {0x3041, 0x33FF},
+    {0x3400, 0x4DBF}, {0x4E00, 0x9FFF}, {0xA000, 0xA4CF}, {0xAC00, 0xD7A3},
+    {0xF900, 0xFAFF}, {0xFE30, 0xFE4F}, {0xFF00, 0xFF60}, {0xFFE0, 0xFFE6},
+    {0x1F300, 0x1F64F}, {0x1F680, 0x1F6FF}, {0x1F900, 0x1F9FF}, {0x1FA70, 0x1FAFF},
+    {0x20000, 0x3FFFD}
+};
+
+// 터미널마다 폭 처리가 다른 기호 영역 (화살표, 기술 기호, 기타 기호)
+static const codepoint_range_t g_ambiguous[] = {
+    {0x2190, 0x21FF}, {0x2300, 0x23FF}, {0x2600, 0x27BF}, {0x2B00, 0x2BFF}
+};
+
+/**
+ * @brief 코드 포인트가 범위 테이블에 포함되는지 확인합니다
+ */
+static bool in_ranges(uint32_t cp, const codepoint_range_t* ranges, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (cp < ranges[i].first) return false;  // 테이블은 오름차순
+        if (cp <= ranges[i].last) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief UTF-8 문자열에서 코드 포인트 하나를 읽습니다
+ *
+ * @param text 읽을 위치
+ * @param cp 읽은 코드 포인트 (잘못된 시퀀스는 '?')
+ * @return 소비한 바이트 수 (문자열 끝이면 0)
+ */
+static int utf8_decode(const char* text, uint32_t* cp) {
+    const unsigned char* s = (const unsigned char*)text;
+    if (s[0] == 0) return 0;
+
+    int len;
+    uint32_t value;
+    if (s[0] < 0x80) { *cp = s[0]; return 1; }
+    else if ((s[0] & 0xE0) == 0xC0) { len = 2; value = s[0] & 0x1F; }
+    else if ((s[0] & 0xF0) == 0xE0) { len = 3; value = s[0] & 0x0F; }
+    else if ((s[0] & 0xF8) == 0xF0) { len = 4; value = s[0] & 0x07; }
+    else { *cp = '?'; return 1; }
+
+    for (int i = 1; i < len; i++) {
+        if ((s[i] & 0xC0) != 0x80) { *cp = '?'; return i; }
+        value = (value << 6) | (s[i] & 0x3F);
+    }
+    *cp = value;
+    return len;
+}
+
+/**
+ * @brief 코드 포인트가 차지하는 화면 칸 수를 계산합니다 (0, 1, 2)
+ */
+static int codepoint_width(uint32_t cp) {
+    if (in_ranges(cp, g_zero_width, sizeof(g_zero_width) / sizeof(g_zero_width[0]))) return 0;
+    if (in_ranges(cp, g_wide, sizeof(g_wide) / sizeof(g_wide[0]))) return 2;
+    return 1;
+}
+
+static bool cell_is_blank(const screen_cell_t* cell) {
+    return cell->len == 0 && cell->flags == 0;
+}
+
+/**
+ * @brief (x, y) 셀이 두 칸 글자의 일부라면 그 글자를 지웁니다
+ *
+ * 두 칸 글자의 절반만 덮어쓰면 나머지 절반이 화면에 남으므로 함께 정리합니다.
+ */
+static void break_wide_cell(int x, int y) {
+    screen_cell_t* cell = &g_back[y][x];
+    if ((cell->flags & SCREEN_CELL_CONTINUATION) && x > 0) {
+        memset(&g_back[y][x - 1], 0, sizeof(screen_cell_t));
+    } else if ((cell->flags & SCREEN_CELL_WIDE) && x + 1 < SCREEN_WIDTH) {
+        memset(&g_back[y][x + 1], 0, sizeof(screen_cell_t));
+    }
+}
+
+/**
+ * @brief 백 버퍼의 한 칸에 글자를 씁니다
+ */
+static void put_glyph(int x, int y, const char* bytes, int len, int width, uint8_t flags) {
+    if (x < 0 || y < 0 || y >= SCREEN_HEIGHT || x + width > SCREEN_WIDTH) return;
+
+    break_wide_cell(x, y);
+    if (width == 2) break_wide_cell(x + 1, y);
+
+    screen_cell_t* cell = &g_back[y][x];
+    memset(cell, 0, sizeof(screen_cell_t));
+
+    // 공백은 색상과 무관하게 빈 셀로 정규화 (비교 비용과 출력량 감소)
+    if (len == 1 && bytes[0] == ' ') return;
+
+    memcpy(cell->glyph, bytes, (size_t)len);
+    cell->len = (uint8_t)len;
+    cell->color = (uint8_t)g_current_color;
+    cell->flags = flags;
+
+    if (width == 2) {
+        cell->flags |= SCREEN_CELL_WIDE;
+        screen_cell_t* next = &g_back[y][x + 1];
+        memset(next, 0, sizeof(screen_cell_t));
+        next->color = cell->color;
+        next->flags = SCREEN_CELL_CONTINUATION;
+    }
+}
+
+void screen_init(void) {
+    memset(g_back, 0, sizeof(g_back));
+    memset(g_front, 0, sizeof(g_front));
+    g_cursor_x = g_cursor_y = 0;
+    g_current_color = COLOR_WHITE;
+    g_full_redraw = true;
+}
+
+void screen_invalidate(void) {
+    g_full_redraw = true;
+}
+
+const screen_cell_t* screen_row(int y) {
+    if (y < 0 || y >= SCREEN_HEIGHT) return NULL;
+    return g_back[y];
+}
+
+// ========== platform.h 콘솔 함수 구현 (모든 백엔드 공통) ==========
+
+void platform_clear_screen(void) {
+    // 백 버퍼만 비움 - 실제로 지워야 할 셀은 다음 출력 때 차분으로 계산됨
+    memset(g_back, 0, sizeof(g_back));
+    g_cursor_x = g_cursor_y = 0;
+}
+
+void platform_goto_xy(int x, int y) {
+    g_cursor_x = x;
+    g_cursor_y = y;
+}
+
+void platform_set_color(color_t color) {
+    g_current_color = color;
+}
+
+void platform_reset_color(void) {
+    g_current_color = COLOR_WHITE;
+}
+
+void platform_print(const char* text) {
+    if (!text) return;
+
+    const char* p = text;
+    while (*p) {
+        if (*p == '\n') {
+            g_cursor_x = 0;
+            g_cursor_y++;
+            p++;
+            continue;
+        }
+        if (*p == '\r') {
+            g_cursor_x = 0;
+            p++;
+            continue;
+        }
+
+        // 글자 하나 (기본 코드 포인트 + 뒤따르는 폭 0 문자들) 모으기
+        uint32_t cp;
+        int n = utf8_decode(p, &cp);
+        int width = codepoint_width(cp);
+        uint8_t flags = in_ranges(cp, g_ambiguous, sizeof(g_ambiguous) / sizeof(g_ambiguous[0]))
+                        ? SCREEN_CELL_AMBIGUOUS : 0;
+        int len = n;      // 소비한 바이트 수
+        int stored = n;   // 셀에 저장할 바이트 수
+
+        uint32_t next_cp;
+        int next_n;
+        while ((next_n = utf8_decode(p + len, &next_cp)) > 0 && codepoint_width(next_cp) == 0) {
+            // 셀에 담을 수 없는 결합 문자는 버림
+            if (stored == len && stored + next_n <= SCREEN_GLYPH_MAX) {
+                stored += next_n;
+            }
+            len += next_n;
+            flags |= SCREEN_CELL_AMBIGUOUS;  // 이모지 표현 선택자 등은 터미널마다 다르게 그려짐
+        }
+
+        if (width == 0) width = 1;  // 선행 문자 없는 결합 문자는 한 칸으로 취급
+
+        // 잘못된 UTF-8은 원래 바이트 대신 '?'로 저장 (깨진 시퀀스를 터미널에 보내지 않음)
+        const char* glyph = p;
+        if (cp == '?' && *p != '?') {
+            glyph = "?";
+            stored = 1;
+        }
+        put_glyph(g_cursor_x, g_cursor_y, glyph, stored, width, flags);
+        g_cursor_x += width;
+        p += len;
+    }
+}
+
+void platform_print_at(int x, int y, const char* text) {
+    platform_goto_xy(x, y);
+    platform_print(text);
+}
+
+void platform_clear_area(int x, int y, int width, int height) {
+    int x_end = x + width;
+    int y_end = y + height;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x_end > SCREEN_WIDTH) x_end = SCREEN_WIDTH;
+    if (y_end > SCREEN_HEIGHT) y_end = SCREEN_HEIGHT;
+    if (x >= x_end || y >= y_end) return;
+
+    for (int row = y; row < y_end; row++) {
+        // 영역 경계에 걸친 두 칸 글자 정리
+        break_wide_cell(x, row);
+        break_wide_cell(x_end - 1, row);
+        memset(&g_back[row][x], 0, (size_t)(x_end - x) * sizeof(screen_cell_t));
+    }
+}
+
+void platform_clear_line(int y) {
+    platform_clear_area(0, y, SCREEN_WIDTH, 1);
+}
+
+// ========== ANSI 차분 출력 ==========
+
+/**
+ * @brief ANSI 출력 상태 (실제 터미널의 커서와 색상 추적)
+ */
+typedef struct {
+    char buffer[16384];
+    size_t used;
+    size_t total;
+    screen_write_fn write;
+    int cursor_x, cursor_y;        // 터미널 커서 위치 (-1이면 알 수 없음)
+    int color;                     // 터미널의 현재 전경색 (-1이면 알 수 없음)
+} ansi_writer_t;
+
+static void ansi_flush(ansi_writer_t* w) {
+    if (w->used > 0) {
+        w->write(w->buffer, w->used);
+        w->total += w->used;
+        w->used = 0;
+    }
+}
+
+static void ansi_append(ansi_writer_t* w, const char* data, size_t len) {
+    if (w->used + len > sizeof(w->buffer)) {
+        ansi_flush(w);
+    }
+    memcpy(w->buffer + w->used, data, len);
+    w->used += len;
+}
+
+static void ansi_move(ansi_writer_t* w, int x, int y) {
+    if (w->cursor_x == x && w->cursor_y == y) return;
+
+    char seq[24];
+    int n;
+    if (w->cursor_y == y && w->cursor_x >= 0 && x > w->cursor_x) {
+        // 같은 줄에서 앞으로 이동할 때는 더 짧은 CUF 사용
+        n = snprintf(seq, sizeof(seq), "\033[%dC", x - w->cursor_x);
+    } else {
+        n = snprintf(seq, sizeof(seq), "\033[%d;%dH", y + 1, x + 1);
+    }
+    ansi_append(w, seq, (size_t)n);
+    w->cursor_x = x;
+    w->cursor_y = y;
+}
+
+static void ansi_color(ansi_writer_t* w, int color) {
+    if (w->color == color || color < 0 || color >= 16) return;
+    ansi_append(w, g_color_codes[color], strlen(g_color_codes[color]));
+    w->color = color;
+}
+
+/**
+ * @brief 같은 줄에서 (x, y)로 이동합니다 - 짧은 빈 칸 간격은 공백으로 채움
+ *
+ * 건너뛸 셀이 모두 공백이면 CUF 시퀀스(4바이트 이상)보다 공백 출력이 짧습니다.
+ */
+static void ansi_move_in_row(ansi_writer_t* w, const screen_cell_t* back, int x, int y) {
+    int gap = x - w->cursor_x;
+    if (w->cursor_y == y && w->cursor_x >= 0 && gap > 0 && gap <= 3) {
+        bool all_blank = true;
+        for (int i = w->cursor_x; i < x; i++) {
+            if (!cell_is_blank(&back[i])) {
+                all_blank = false;
+                break;
+            }
+        }
+        if (all_blank) {
+            ansi_append(w, "   ", (size_t)gap);
+            w->cursor_x = x;
+            return;
+        }
+    }
+    ansi_move(w, x, y);
+}
+
+/**
+ * @brief 한 줄의 변경분을 ANSI 시퀀스로 출력합니다
+ */
+static void ansi_diff_row(ansi_writer_t* w, int y) {
+    const screen_cell_t* back = g_back[y];
+    const screen_cell_t* front = g_front[y];
+
+    int x = 0;
+    while (x < SCREEN_WIDTH) {
+        if (memcmp(&back[x], &front[x], sizeof(screen_cell_t)) == 0) {
+            x++;
+            continue;
+        }
+
+        // 두 칸 글자의 둘째 칸이 바뀌었으면 첫 칸부터 다시 출력
+        if ((back[x].flags & SCREEN_CELL_CONTINUATION) && x > 0) {
+            x--;
+        }
+
+        if (cell_is_blank(&back[x])) {
+            int run_end = x;
+            while (run_end < SCREEN_WIDTH && cell_is_blank(&back[run_end])) run_end++;
+
+            ansi_move_in_row(w, back, x, y);
+            if (run_end == SCREEN_WIDTH) {
+                // 줄 끝까지 비어 있으면 EL 하나로 처리
+                ansi_append(w, "\033[K", 3);
+            } else if (run_end - x >= 4) {
+                // 긴 공백은 ECH로 처리 (커서는 움직이지 않음)
+                char seq[16];
+                int n = snprintf(seq, sizeof(seq), "\033[%dX", run_end - x);
+                ansi_append(w, seq, (size_t)n);
+            } else {
+                ansi_append(w, "    ", (size_t)(run_end - x));
+                w->cursor_x += run_end - x;
+            }
+            x = run_end;
+            continue;
+        }
+
+        ansi_move_in_row(w, back, x, y);
+        ansi_color(w, back[x].color);
+        ansi_append(w, back[x].glyph, back[x].len);
+
+        int width = (back[x].flags & SCREEN_CELL_WIDE) ? 2 : 1;
+        if (back[x].flags & SCREEN_CELL_AMBIGUOUS) {
+            // 터미널이 실제로 몇 칸 전진했는지 알 수 없으므로 다음 출력 전에 커서를 다시 지정
+            w->cursor_x = -1;
+        } else {
+            w->cursor_x += width;
+        }
+        x += width;
+    }
+}
+
+size_t screen_flush_ansi(screen_write_fn write) {
+    static ansi_writer_t writer;
+    ansi_writer_t* w = &writer;
+
+    w->used = 0;
+    w->total = 0;
+    w->write = write;
+    w->cursor_x = -1;
+    w->cursor_y = -1;
+    w->color = -1;
+
+    if (g_full_redraw) {
+        // 터미널 내용을 알 수 없으므로 전체 지우고 빈 화면에서 시작
+        ansi_append(w, "\033[0m\033[2J", 8);
+        memset(g_front, 0, sizeof(g_front));
+        g_full_redraw = false;
+    }
+
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        if (memcmp(g_back[y], g_front[y], sizeof(g_back[y])) == 0) continue;
+        ansi_diff_row(w, y);
+        memcpy(g_front[y], g_back[y], sizeof(g_back[y]));
+    }
+
+    ansi_flush(w);
+    return w->total;
+}
+
+int screen_collect_dirty_rows(bool dirty[SCREEN_HEIGHT]) {
+    int count = 0;
+    bool full = g_full_redraw;
+    g_full_redraw = false;
+
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        dirty[y] = full || memcmp(g_back[y], g_front[y], sizeof(g_back[y])) != 0;
+        if (dirty[y]) {
+            memcpy(g_front[y], g_back[y], sizeof(g_back[y]));
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file screen.h
+ * @brief 모든 플랫폼이 공유하는 가상 화면(셀 그리드) 합성기
+ *
+ * 게임과 UI는 platform_print_at 등을 통해 백 버퍼에 그리기만 하고,
+ * platform_present_buffer 시점에 백 버퍼와 프론트 버퍼(실제 화면 내용)를
+ * 비교하여 바뀐 셀만 각 백엔드가 출력합니다.
+ */
+
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include <stddef.h>
+#include "platform.h"
+
+// 가상 화면 크기 (platform_set_console_size(120, 50)와 일치)
+#define SCREEN_WIDTH 120
+#define SCREEN_HEIGHT 50
+
+// 셀 하나에 담을 수 있는 최대 UTF-8 바이트 수 (결합 문자/이형 선택자 포함)
+#define SCREEN_GLYPH_MAX 8
+
+// 셀 플래그
+#define SCREEN_CELL_WIDE         0x01  // 두 칸 폭 글자의 첫 칸
+#define SCREEN_CELL_CONTINUATION 0x02  // 두 칸 폭 글자의 둘째 칸 (내용 없음)
+#define SCREEN_CELL_AMBIGUOUS    0x04  // 터미널마다 폭이 다를 수 있는 글자
+
+/**
+ * @brief 가상 화면의 한 칸
+ *
+ * len이 0이고 flags가 0인 셀은 공백입니다. 비교는 memcmp로 하므로
+ * 사용하지 않는 바이트는 항상 0으로 유지합니다.
+ */
+typedef struct {
+    char glyph[SCREEN_GLYPH_MAX];  // UTF-8 바이트 (널 종료 아님)
+    uint8_t len;                   // glyph 바이트 수
+    uint8_t color;                 // 전경색 (color_t)
+    uint8_t flags;                 // SCREEN_CELL_* 플래그
+    uint8_t reserved;              // 정렬용 (항상 0)
+} screen_cell_t;
+
+/**
+ * @brief 출력 바이트를 백엔드로 내보내는 함수 타입
+ */
+typedef void (*screen_write_fn)(const char* data, size_t len);
+
+// 초기화 및 무효화
+void screen_init(void);
+void screen_invalidate(void);  // 다음 출력에서 화면 전체를 다시 그림
+
+// 백 버퍼 읽기 (웹 백엔드용)
+const screen_cell_t* screen_row(int y);
+
+// 변경분 계산 및 반영
+size_t screen_flush_ansi(screen_write_fn write);    // ANSI 터미널용: 바뀐 셀만 이스케이프 시퀀스로 출력
+int screen_collect_dirty_rows(bool dirty[SCREEN_HEIGHT]);  // 줄 단위 변경 여부 계산 (변경된 줄 수 반환)
+
+#endif // SCREEN_H
@@ -0,0 +1,189 @@
+#include "thread_pool.h"
+#include <stdlib.h>
+
+// 풀이 만들 수 있는 최대 작업자 수
+#define THREAD_POOL_MAX_THREADS 64
+
+/**
+ * @brief 퓨처 내부 구조체
+ *
+ * 제출한 쪽과 작업자 쪽이 각각 참조를 하나씩 가지며,
+ * 마지막 참조가 해제될 때 메모리를 돌려줍니다.
+ */
+struct future {
+    mutex_handle_t mutex;          // done/result 보호
+    cond_handle_t done_cond;       // 완료 알림
+    volatile int32_t ready;        // 완료 여부 (잠금 없이 확인용)
+    volatile int32_t ref_count;    // 참조 수
+    void* result;                  // 작업 반환값
+};
+
+/**
+ * @brief 대기열의 작업 하나
+ */
+typedef struct pool_task {
+    thread_func_t func;            // 실행할 함수
+    void* arg;                     // 함수 인자
+    future_t* future;              // 결과를 받을 퓨처
+    struct pool_task* next;        // 다음 작업
+} pool_task_t;
+
+/**
+ * @brief 스레드 풀 내부 구조체
+ */
+struct thread_pool {
+    mutex_handle_t mutex;          // 대기열 보호
+    cond_handle_t not_empty;       // 작업 도착/종료 알림
+    pool_task_t* head;             // 대기열 앞
+    pool_task_t* tail;             // 대기열 뒤
+    bool shutdown;                 // 종료 요청
+    int num_threads;               // 실행 중인 작업자 수
+    thread_handle_t threads[THREAD_POOL_MAX_THREADS];
+};
+
+static void future_complete(future_t* future, void* result) {
+    platform_lock_mutex(future->mutex);
+    future->result = result;
+    platform_atomic_store(&future->ready, 1);
+    platform_cond_broadcast(future->done_cond);
+    platform_unlock_mutex(future->mutex);
+}
+
+static void run_task(pool_task_t* task) {
+    void* result = task->func(task->arg);
+    future_complete(task->future, result);
+    future_release(task->future);
+    free(task);
+}
+
+static void* worker_main(void* arg) {
+    thread_pool_t* pool = (thread_pool_t*)arg;
+
+    for (;;) {
+        platform_lock_mutex(pool->mutex);
+        while (!pool->head && !pool->shutdown) {
+            platform_cond_wait(pool->not_empty, pool->mutex);
+        }
+
+        // 종료 요청이 있어도 남은 작업은 모두 처리
+        pool_task_t* task = pool->head;
+        if (!task) {
+            platform_unlock_mutex(pool->mutex);
+            break;
+        }
+        pool->head = task->next;
+        if (!pool->head) pool->tail = NULL;
+        platform_unlock_mutex(pool->mutex);
+
+        run_task(task);
+    }
+    return NULL;
+}
+
+thread_pool_t* thread_pool_create(int num_threads) {
+    thread_pool_t* pool = calloc(1, sizeof(thread_pool_t));
+    if (!pool) return NULL;
+
+    pool->mutex = platform_create_mutex();
+    pool->not_empty = platform_create_cond();
+
+    if (num_threads <= 0) num_threads = platform_cpu_count();
+    if (num_threads > THREAD_POOL_MAX_THREADS) num_threads = THREAD_POOL_MAX_THREADS;
+
+    // 조건 변수가 없는 플랫폼(웹)은 작업자 없이 동기 실행
+    if (!pool->mutex.handle || !pool->not_empty.handle) {
+        return pool;
+    }
+
+    for (int i = 0; i < num_threads; i++) {
+        thread_handle_t thread = platform_create_thread(worker_main, pool);
+        if (!thread.handle) break;
+        pool->threads[pool->num_threads++] = thread;
+    }
+    return pool;
+}
+
+void thread_pool_destroy(thread_pool_t* pool) {
+    if (!pool) return;
+
+    platform_lock_mutex(pool->mutex);
+    pool->shutdown = true;
+    platform_cond_broadcast(pool->not_empty);
+    platform_unlock_mutex(pool->mutex);
+
+    for (int i = 0; i < pool->num_threads; i++) {
+        platform_join_thread(pool->threads[i]);
+    }
+
+    platform_destroy_cond(pool->not_empty);
+    platform_destroy_mutex(pool->mutex);
+    free(pool);
+}
+
+int thread_pool_size(const thread_pool_t* pool) {
+    return pool ? pool->num_threads : 0;
+}
+
+future_t* thread_pool_submit(thread_pool_t* pool, thread_func_t func, void* arg) {
+    if (!pool || !func) return NULL;
+
+    future_t* future = calloc(1, sizeof(future_t));
+    pool_task_t* task = malloc(sizeof(pool_task_t));
+    if (!future || !task) {
+        free(future);
+        free(task);
+        return NULL;
+    }
+
+    future->mutex = platform_create_mutex();
+    future->done_cond = platform_create_cond();
+    future->ref_count = 2;  // 제출한 쪽 + 작업 쪽
+
+    task->func = func;
+    task->arg = arg;
+    task->future = future;
+    task->next = NULL;
+
+    if (pool->num_threads == 0) {
+        run_task(task);
+        return future;
+    }
+
+    platform_lock_mutex(pool->mutex);
+    if (pool->tail) {
+        pool->tail->next = task;
+    } else {
+        pool->head = task;
+    }
+    pool->tail = task;
+    platform_cond_signal(pool->not_empty);
+    platform_unlock_mutex(pool->mutex);
+
+    return future;
+}
+
+void* future_get(future_t* future) {
+    if (!future) return NULL;
+
+    platform_lock_mutex(future->mutex);
+    while (!platform_atomic_load(&future->ready)) {
+        platform_cond_wait(future->done_cond, future->mutex);
+    }
+    void* result = future->result;
+    platform_unlock_mutex(future->mutex);
+    return result;
+}
+
+bool future_is_ready(future_t* future) {
+    return future && platform_atomic_load(&future->ready) != 0;
+}
+
+void future_release(future_t* future) {
+    if (!future) return;
+
+    if (platform_atomic_fetch_add(&future->ref_count, -1) == 1) {
+        platform_destroy_cond(future->done_cond);
+        platform_destroy_mutex(future->mutex);
+        free(future);
+    }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file thread_pool.h
+ * @brief 고정 크기 스레드 풀과 퓨처(future)
+ *
+ * 작업자 스레드를 미리 만들어 두고 제출된 작업을 순서대로 실행합니다.
+ * 작업 결과는 퓨처로 돌려받으며, 작업자 스레드를 만들 수 없는 플랫폼(웹)에서는
+ * 제출 즉시 호출한 스레드에서 작업을 실행합니다.
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdbool.h>
+#include "platform.h"
+
+/**
+ * @brief 스레드 풀 (불투명 타입)
+ */
+typedef struct thread_pool thread_pool_t;
+
+/**
+ * @brief 제출한 작업의 결과 (불투명 타입)
+ */
+typedef struct future future_t;
+
+/**
+ * @brief 스레드 풀 생성
+ * @param num_threads 작업자 스레드 수 (0 이하이면 platform_cpu_count 사용)
+ * @return 생성된 풀, 실패 시 NULL
+ */
+thread_pool_t* thread_pool_create(int num_threads);
+
+/**
+ * @brief 스레드 풀 파괴
+ *
+ * 이미 제출된 작업을 모두 실행한 뒤 작업자 스레드를 종료합니다.
+ * @param pool 스레드 풀
+ */
+void thread_pool_destroy(thread_pool_t* pool);
+
+/**
+ * @brief 실제로 실행 중인 작업자 스레드 수
+ * @param pool 스레드 풀
+ * @return 작업자 수 (0이면 제출한 스레드에서 바로 실행)
+ */
+int thread_pool_size(const thread_pool_t* pool);
+
+/**
+ * @brief 작업 제출
+ * @param pool 스레드 풀
+ * @param func 실행할 함수
+ * @param arg 함수 인자
+ * @return 결과를 받을 퓨처 (future_release로 해제), 실패 시 NULL
+ */
+future_t* thread_pool_submit(thread_pool_t* pool, thread_func_t func, void* arg);
+
+/**
+ * @brief 작업이 끝날 때까지 기다린 뒤 결과 반환
+ * @param future 퓨처
+ * @return 작업 함수의 반환값
+ */
+void* future_get(future_t* future);
+
+/**
+ * @brief 작업 완료 여부 확인 (대기하지 않음)
+ * @param future 퓨처
+ * @return 완료되었으면 true
+ */
+bool future_is_ready(future_t* future);
+
+/**
+ * @brief 퓨처 해제 (작업이 아직 실행 중이어도 안전)
+ * @param future 퓨처
+ */
+void future_release(future_t* future);
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,194 @@
+#include "timer_wheel.h"
+
+#define TIMER_WHEEL_MASK (TIMER_WHEEL_SLOTS - 1)
+// 예약할 수 있는 가장 먼 시간 (밀리초, 넘으면 이 시간으로 줄임)
+#define TIMER_WHEEL_MAX_DELAY ((1ull << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS)) - 1)
+
+static void list_init(timer_node_t* head) {
+    head->next = head;
+    head->prev = head;
+}
+
+static void list_append(timer_node_t* head, timer_node_t* node) {
+    node->prev = head->prev;
+    node->next = head;
+    head->prev->next = node;
+    head->prev = node;
+}
+
+static void list_unlink(timer_node_t* node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+/**
+ * @brief 슬롯의 목록을 통째로 떼어 head에 옮깁니다 (슬롯은 빈 상태가 됨)
+ */
+static void list_take(timer_node_t* slot, timer_node_t* head) {
+    if (slot->next == slot) {
+        list_init(head);
+        return;
+    }
+    head->next = slot->next;
+    head->prev = slot->prev;
+    head->next->prev = head;
+    head->prev->next = head;
+    list_init(slot);
+}
+
+/**
+ * @brief 남은 시간에 맞는 단과 슬롯에 타이머를 넣습니다
+ *
+ * 첫 단은 64밀리초 안, 둘째 단은 64² 밀리초 안의 타이머를 맡는 식입니다.
+ */
+static void insert_timer(timer_wheel_t* wheel, timer_node_t* timer) {
+    uint64_t expires = timer->expires < wheel->current ? wheel->current : timer->expires;
+    uint64_t delta = expires - wheel->current;
+
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1ull << (TIMER_WHEEL_SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    int slot = (int)((expires >> (TIMER_WHEEL_SLOT_BITS * level)) & TIMER_WHEEL_MASK);
+    list_append(&wheel->slots[level][slot], timer);
+}
+
+/**
+ * @brief 윗단 슬롯 하나의 타이머를 남은 시간에 맞게 다시 넣습니다
+ * @return 슬롯 번호 (0이면 그 윗단도 한 칸 넘어가야 함)
+ */
+static int cascade(timer_wheel_t* wheel, int level) {
+    int slot = (int)((wheel->current >> (TIMER_WHEEL_SLOT_BITS * level)) & TIMER_WHEEL_MASK);
+    timer_node_t list;
+    list_take(&wheel->slots[level][slot], &list);
+
+    while (list.next != &list) {
+        timer_node_t* timer = list.next;
+        list_unlink(timer);
+        insert_timer(wheel, timer);
+    }
+    return slot;
+}
+
+/**
+ * @brief 타이머 휠 초기화
+ * @param wheel 타이머 휠
+ * @param now_ms 현재 시각 (밀리초)
+ */
+void timer_wheel_init(timer_wheel_t* wheel, uint64_t now_ms) {
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            list_init(&wheel->slots[level][slot]);
+        }
+    }
+    wheel->current = now_ms;
+    wheel->count = 0;
+}
+
+/**
+ * @brief 타이머 예약 (이미 예약돼 있으면 새 시각으로 옮김)
+ *
+ * 이미 지난 시각이면 다음 timer_wheel_advance에서 바로 만료됩니다.
+ *
+ * @param wheel 타이머 휠
+ * @param timer 타이머 (처음 쓰기 전에 0으로 초기화)
+ * @param expires_ms 만료 시각 (밀리초)
+ */
+void timer_wheel_schedule(timer_wheel_t* wheel, timer_node_t* timer, uint64_t expires_ms) {
+    if (timer->prev) {
+        list_unlink(timer);
+    } else {
+        wheel->count++;
+    }
+
+    if (expires_ms > wheel->current + TIMER_WHEEL_MAX_DELAY) {
+        expires_ms = wheel->current + TIMER_WHEEL_MAX_DELAY;
+    }
+    timer->expires = expires_ms;
+    insert_timer(wheel, timer);
+}
+
+void timer_wheel_cancel(timer_wheel_t* wheel, timer_node_t* timer) {
+    if (!timer->prev) return;
+    list_unlink(timer);
+    wheel->count--;
+}
+
+bool timer_wheel_pending(const timer_node_t* timer) {
+    return timer->prev != NULL;
+}
+
+/**
+ * @brief now_ms까지 만료된 타이머를 모두 꺼내 callback을 부릅니다
+ *
+ * 같은 밀리초에 만료된 타이머끼리는 예약한 순서대로 불립니다.
+ *
+ * @param wheel 타이머 휠
+ * @param now_ms 현재 시각 (밀리초)
+ * @param callback 만료된 타이머마다 부를 함수
+ * @param context callback에 넘길 값
+ * @return 만료된 타이머 수
+ */
+size_t timer_wheel_advance(timer_wheel_t* wheel, uint64_t now_ms, timer_callback_t callback, void* context) {
+    size_t expired = 0;
+
+    while (wheel->current <= now_ms) {
+        int slot = (int)(wheel->current & TIMER_WHEEL_MASK);
+
+        // 첫 단이 한 바퀴 돌았으면 윗단에서 다음 구간의 타이머를 내려받음
+        if (slot == 0) {
+            for (int level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+                if (cascade(wheel, level) != 0) break;
+            }
+        }
+
+        timer_node_t list;
+        list_take(&wheel->slots[0][slot], &list);
+
+        // 콜백이 다시 예약하는 타이머가 지금 꺼낸 슬롯에 들어가지 않도록 먼저 넘김
+        wheel->current++;
+
+        while (list.next != &list) {
+            timer_node_t* timer = list.next;
+            list_unlink(timer);
+            wheel->count--;
+            expired++;
+            callback(timer, context);
+        }
+    }
+    return expired;
+}
+
+/**
+ * @brief 다음에 만료될 수 있는 가장 이른 시각
+ *
+ * 첫 단은 정확히 찾고, 윗단에 타이머가 있으면 다음 내려받기 시각을 함께 고려하므로
+ * 실제 만료보다 일찍 깨어날 수는 있어도 늦게 깨어나지는 않습니다.
+ */
+uint64_t timer_wheel_next_expiry(const timer_wheel_t* wheel) {
+    if (wheel->count == 0) return UINT64_MAX;
+
+    uint64_t earliest = UINT64_MAX;
+    for (int i = 0; i < TIMER_WHEEL_SLOTS; i++) {
+        uint64_t time = wheel->current + (uint64_t)i;
+        const timer_node_t* slot = &wheel->slots[0][time & TIMER_WHEEL_MASK];
+        if (slot->next != slot) {
+            earliest = time;
+            break;
+        }
+    }
+
+    for (int level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+        for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            const timer_node_t* head = &wheel->slots[level][slot];
+            if (head->next != head) {
+                uint64_t boundary = (wheel->current & TIMER_WHEEL_MASK) == 0
+                                    ? wheel->current : (wheel->current | TIMER_WHEEL_MASK) + 1;
+                return boundary < earliest ? boundary : earliest;
+            }
+        }
+    }
+    return earliest;
+}
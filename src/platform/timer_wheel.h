@@ -0,0 +1,54 @@
+/**
+ * @file timer_wheel.h
+ * @brief 많은 타이머를 O(1)로 예약하는 계층형 타이머 휠
+ *
+ * 1밀리초 단위 슬롯 64개짜리 휠 네 단을 겹쳐 약 4.6시간까지 예약합니다.
+ * 가까운 타이머는 첫 단에, 먼 타이머는 윗단에 넣고, 아랫단이 한 바퀴 돌 때마다
+ * 윗단 슬롯 하나를 내려보내므로(cascade) 예약과 취소는 타이머 수와 관계없이
+ * 상수 시간입니다. 타이머 노드는 호출한 쪽 구조체에 넣어 쓰며 따로 할당하지 않습니다.
+ * 스레드 안전하지 않으므로 한 스레드에서만 사용합니다.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief 타이머 하나 (호출한 쪽 구조체에 넣어 사용)
+ */
+typedef struct timer_node {
+    struct timer_node* next;       // 같은 슬롯의 다음 타이머
+    struct timer_node* prev;       // 같은 슬롯의 이전 타이머 (NULL이면 예약되지 않음)
+    uint64_t expires;              // 만료 시각 (밀리초)
+    void* user;                    // 호출한 쪽 데이터
+} timer_node_t;
+
+/**
+ * @brief 만료된 타이머를 받는 함수 (타이머는 이미 휠에서 빠져 있어 다시 예약해도 됨)
+ */
+typedef void (*timer_callback_t)(timer_node_t* timer, void* context);
+
+/**
+ * @brief 계층형 타이머 휠
+ */
+typedef struct {
+    timer_node_t slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];  // 슬롯마다 원형 목록의 머리
+    uint64_t current;              // 다음에 처리할 시각 (밀리초)
+    size_t count;                  // 예약된 타이머 수
+} timer_wheel_t;
+
+void timer_wheel_init(timer_wheel_t* wheel, uint64_t now_ms);
+void timer_wheel_schedule(timer_wheel_t* wheel, timer_node_t* timer, uint64_t expires_ms);  // 이미 예약돼 있으면 옮김
+void timer_wheel_cancel(timer_wheel_t* wheel, timer_node_t* timer);
+bool timer_wheel_pending(const timer_node_t* timer);
+size_t timer_wheel_advance(timer_wheel_t* wheel, uint64_t now_ms, timer_callback_t callback, void* context);
+uint64_t timer_wheel_next_expiry(const timer_wheel_t* wheel);  // 다음에 깨어나야 할 시각 (비었으면 UINT64_MAX)
+
+#endif // TIMER_WHEEL_H
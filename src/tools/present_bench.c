@@ -0,0 +1,81 @@
+/**
+ * @file present_bench.c
+ * @brief 웹 백엔드 화면 출력(platform_present_buffer) 측정 도구
+ *
+ * Emscripten 빌드 전용으로, node에서 실행합니다. web/present_bench_pre.js가
+ * 줄 요소만 흉내 내는 작은 document를 만들어 두므로 브라우저 없이도
+ * 변경 줄 계산, UTF-8 인코딩, JavaScript 호출과 줄 갱신까지의 비용을 잴 수 있습니다.
+ *
+ * 매 프레임 화면 전체가 바뀌는 경우와 한 줄만 바뀌는 경우의 프레임당 시간을 출력합니다.
+ *
+ * 사용법: node present_bench.js [프레임 수]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <emscripten.h>
+#include "platform/platform.h"
+#include "platform/screen.h"
+
+#define PRESENT_BENCH_FRAMES 2000
+
+/**
+ * @brief y번째 줄을 프레임마다 다른 내용으로 채웁니다
+ *
+ * 한글(두 칸 글자)과 ASCII를 섞어 실제 게임 화면과 비슷한 인코딩 부담을 줍니다.
+ */
+static void draw_row(int y, int frame) {
+    char line[SCREEN_WIDTH * 3 + 1];
+    char* p = line;
+    int columns = 0;
+
+    int shift = (frame + y) % 10;
+    for (int i = 0; i < shift; i++, columns++) {
+        *p++ = ' ';
+    }
+    p += sprintf(p, "점수 %6d ", frame * 10 + y);
+    columns += 5 + 7;
+    while (columns < SCREEN_WIDTH - 1) {
+        *p++ = (char)('#' + (frame + columns) % 4);
+        columns++;
+    }
+    *p = '\0';
+    platform_print_at(0, y, line);
+}
+
+/**
+ * @brief 그리기와 출력을 frames번 반복하고 프레임당 평균 마이크로초를 돌려줍니다
+ */
+static double run_frames(int frames, bool full_frame) {
+    // 측정 전에 화면 전체를 한 번 그려 줄 요소와 프론트 버퍼를 맞춤
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        draw_row(y, 0);
+    }
+    platform_present_buffer();
+
+    double start = emscripten_get_now();
+    for (int frame = 1; frame <= frames; frame++) {
+        if (full_frame) {
+            for (int y = 0; y < SCREEN_HEIGHT; y++) {
+                draw_row(y, frame);
+            }
+        } else {
+            draw_row(SCREEN_HEIGHT / 2, frame);
+        }
+        platform_present_buffer();
+    }
+    return (emscripten_get_now() - start) * 1000.0 / frames;
+}
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : PRESENT_BENCH_FRAMES;
+    if (frames <= 0) frames = PRESENT_BENCH_FRAMES;
+
+    screen_init();
+
+    printf("platform_present_buffer (%d프레임)\n", frames);
+    printf("  화면 전체 변경: %8.2f us/프레임\n", run_frames(frames, true));
+    printf("  한 줄 변경:     %8.2f us/프레임\n", run_frames(frames, false));
+    return 0;
+}
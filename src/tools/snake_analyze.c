@@ -0,0 +1,398 @@
+/**
+ * @file snake_analyze.c
+ * @brief 리플레이 모음을 모든 코어로 분석하는 도구
+ *
+ * 리플레이를 한 틱씩 다시 시뮬레이션하며 사망 위치, 사과를 먹은 위치,
+ * AI 특성별 승률, 평균 생존 틱을 모읍니다. 파일마다 메모리 매핑한 리더와
+ * 게임 상태 하나만 쓰므로 파일 크기와 관계없이 메모리 사용량이 일정하고,
+ * 작업자 스레드는 파일을 하나씩 가져가 자기 집계에만 더한 뒤 마지막에 합칩니다.
+ * 파일 하나의 결과는 따로 모았다가 끝까지 재생했을 때만 더하므로, 잘렸거나
+ * 손상된 파일은 건너뛴 수에만 들어갑니다.
+ *
+ * 사용법: snake_analyze [--format json|csv] [--threads N] <디렉터리 또는 .snkr 파일>...
+ *         디렉터리는 그 안의 .snkr 파일을 모두 분석합니다 (하위 디렉터리 제외).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform/platform.h"
+#include "platform/thread_pool.h"
+#include "game/game.h"
+#include "game/replay.h"
+
+#define ANALYZE_ROLES 2                // 0: 사용자, 1: AI
+#define ANALYZE_PERSONALITIES 5        // ai_personality_t 값 수
+#define REPLAY_SUFFIX ".snkr"
+
+static const char* role_names[ANALYZE_ROLES] = {"human", "ai"};
+static const char* personality_names[ANALYZE_PERSONALITIES] = {
+    "balanced", "aggressive", "defensive", "cautious", "reckless"
+};
+
+/**
+ * @brief 리플레이 모음의 집계 결과
+ */
+typedef struct {
+    uint32_t files;                                        // 분석한 파일 수
+    uint32_t skipped;                                      // 열 수 없거나 탐색할 수 없는 파일 수
+    uint64_t ticks;                                        // 다시 시뮬레이션한 틱 합계
+    uint32_t deaths[ANALYZE_ROLES][GAME_HEIGHT][GAME_WIDTH];  // 역할별 사망 위치
+    uint32_t apples[GAME_HEIGHT][GAME_WIDTH];              // 사과를 먹은 위치
+    uint64_t survival_ticks[ANALYZE_ROLES];                // 역할별 생존 틱 합계
+    uint32_t survival_count[ANALYZE_ROLES];                // 역할별 뱀 수
+    uint32_t matches[ANALYZE_PERSONALITIES];               // AI 대전 수
+    uint32_t ai_wins[ANALYZE_PERSONALITIES];               // AI 승리
+    uint32_t human_wins[ANALYZE_PERSONALITIES];            // 사용자 승리
+    uint32_t draws[ANALYZE_PERSONALITIES];                 // 무승부
+} analysis_t;
+
+/**
+ * @brief 분석할 파일 목록 (작업자들이 원자적으로 하나씩 가져감)
+ */
+typedef struct {
+    char** paths;                  // 파일 경로
+    int count;                     // 파일 수
+    int capacity;                  // paths 할당 크기
+    volatile int32_t next;         // 다음에 가져갈 파일 인덱스
+} corpus_t;
+
+/**
+ * @brief 작업자 하나의 입력과 집계
+ */
+typedef struct {
+    corpus_t* corpus;
+    analysis_t result;
+    analysis_t file;               // 지금 분석 중인 파일 하나의 결과
+} worker_t;
+
+static bool add_path(corpus_t* corpus, const char* path) {
+    if (corpus->count == corpus->capacity) {
+        int capacity = corpus->capacity ? corpus->capacity * 2 : 256;
+        char** paths = realloc(corpus->paths, (size_t)capacity * sizeof(char*));
+        if (!paths) return false;
+        corpus->paths = paths;
+        corpus->capacity = capacity;
+    }
+
+    size_t size = strlen(path) + 1;
+    char* copy = malloc(size);
+    if (!copy) return false;
+    memcpy(copy, path, size);
+    corpus->paths[corpus->count++] = copy;
+    return true;
+}
+
+/**
+ * @brief 디렉터리 항목 중 리플레이 파일을 목록에 추가합니다
+ */
+typedef struct {
+    corpus_t* corpus;
+    const char* directory;
+} directory_scan_t;
+
+static void add_directory_entry(const char* name, void* user) {
+    directory_scan_t* scan = (directory_scan_t*)user;
+    size_t length = strlen(name);
+    size_t suffix = strlen(REPLAY_SUFFIX);
+    if (length <= suffix || strcmp(name + length - suffix, REPLAY_SUFFIX) != 0) return;
+
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", scan->directory, name);
+    add_path(scan->corpus, path);
+}
+
+/**
+ * @brief 리플레이 하나를 한 틱씩 다시 시뮬레이션하며 집계합니다
+ *
+ * @param path 리플레이 경로
+ * @param out 이 파일의 집계 (0으로 초기화된 상태, 실패하면 버림)
+ * @return 파일을 열고 끝까지 재생했으면 true
+ */
+static bool analyze_file(const char* path, analysis_t* out) {
+    replay_reader_t* reader = replay_reader_open(path);
+    if (!reader) return false;
+
+    const replay_header_t* header = replay_reader_header(reader);
+    uint32_t final_tick = replay_reader_final_tick(reader);
+    if (!replay_reader_seek(reader, 0)) {
+        replay_reader_close(reader);
+        return false;
+    }
+
+    // 리더는 같은 게임 상태를 앞으로 진행시키므로 포인터는 그대로 유효
+    const game_state_t* game = replay_reader_state(reader);
+    bool alive[MAX_PLAYERS];
+    int length[MAX_PLAYERS];
+    for (int i = 0; i < game->num_players; i++) {
+        alive[i] = game->players[i].alive;
+        length[i] = game->players[i].length;
+    }
+
+    uint32_t tick = 0;
+    while (tick < final_tick && replay_reader_seek(reader, tick + 1)) {
+        tick++;
+        for (int i = 0; i < game->num_players; i++) {
+            const snake_t* snake = &game->players[i];
+            int role = snake->type == PLAYER_HUMAN ? 0 : 1;
+            position_t head = snake->head->pos;
+            bool on_board = head.x >= 0 && head.x < GAME_WIDTH && head.y >= 0 && head.y < GAME_HEIGHT;
+
+            if (alive[i] && !snake->alive) {
+                // 죽을 때는 머리가 움직이지 않으므로 마지막으로 있던 칸
+                if (on_board) out->deaths[role][head.y][head.x]++;
+                out->survival_ticks[role] += tick;
+                out->survival_count[role]++;
+                alive[i] = false;
+            } else if (snake->alive && snake->length > length[i] && on_board) {
+                out->apples[head.y][head.x]++;
+            }
+            length[i] = snake->length;
+        }
+    }
+    out->ticks += tick;
+
+    // 끝까지 살아남은 뱀
+    for (int i = 0; i < game->num_players; i++) {
+        if (alive[i]) {
+            int role = game->players[i].type == PLAYER_HUMAN ? 0 : 1;
+            out->survival_ticks[role] += tick;
+            out->survival_count[role]++;
+        }
+    }
+
+    // AI 대전 결과 (플레이어 0이 사용자)
+    int personality = header->personality;
+    if (header->mode != GAME_MODE_SINGLE && personality >= 0 && personality < ANALYZE_PERSONALITIES) {
+        out->matches[personality]++;
+        if (game->winner_id == 0) {
+            out->human_wins[personality]++;
+        } else if (game->winner_id > 0) {
+            out->ai_wins[personality]++;
+        } else {
+            out->draws[personality]++;
+        }
+    }
+
+    replay_reader_close(reader);
+    return tick == final_tick;
+}
+
+static void merge_analysis(analysis_t* total, const analysis_t* part) {
+    total->files += part->files;
+    total->skipped += part->skipped;
+    total->ticks += part->ticks;
+    for (int role = 0; role < ANALYZE_ROLES; role++) {
+        for (int y = 0; y < GAME_HEIGHT; y++) {
+            for (int x = 0; x < GAME_WIDTH; x++) {
+                total->deaths[role][y][x] += part->deaths[role][y][x];
+            }
+        }
+        total->survival_ticks[role] += part->survival_ticks[role];
+        total->survival_count[role] += part->survival_count[role];
+    }
+    for (int y = 0; y < GAME_HEIGHT; y++) {
+        for (int x = 0; x < GAME_WIDTH; x++) {
+            total->apples[y][x] += part->apples[y][x];
+        }
+    }
+    for (int p = 0; p < ANALYZE_PERSONALITIES; p++) {
+        total->matches[p] += part->matches[p];
+        total->ai_wins[p] += part->ai_wins[p];
+        total->human_wins[p] += part->human_wins[p];
+        total->draws[p] += part->draws[p];
+    }
+}
+
+static void* worker_main(void* arg) {
+    worker_t* worker = (worker_t*)arg;
+    corpus_t* corpus = worker->corpus;
+
+    for (;;) {
+        int index = platform_atomic_fetch_add(&corpus->next, 1);
+        if (index >= corpus->count) break;
+
+        memset(&worker->file, 0, sizeof(worker->file));
+        if (analyze_file(corpus->paths[index], &worker->file)) {
+            merge_analysis(&worker->result, &worker->file);
+            worker->result.files++;
+        } else {
+            worker->result.skipped++;
+        }
+    }
+    return worker;
+}
+
+static double average(uint64_t sum, uint32_t count) {
+    return count ? (double)sum / count : 0.0;
+}
+
+static double ratio(uint32_t part, uint32_t whole) {
+    return whole ? (double)part / whole : 0.0;
+}
+
+static void print_heatmap_json(uint32_t map[GAME_HEIGHT][GAME_WIDTH]) {
+    printf("[");
+    for (int y = 0; y < GAME_HEIGHT; y++) {
+        printf("%s\n    [", y ? "," : "");
+        for (int x = 0; x < GAME_WIDTH; x++) {
+            printf("%s%u", x ? "," : "", (unsigned)map[y][x]);
+        }
+        printf("]");
+    }
+    printf("\n  ]");
+}
+
+static void print_json(const analysis_t* result) {
+    printf("{\n");
+    printf("  \"files\": %u,\n  \"skipped\": %u,\n  \"ticks\": %llu,\n",
+           (unsigned)result->files, (unsigned)result->skipped, (unsigned long long)result->ticks);
+    printf("  \"width\": %d,\n  \"height\": %d,\n", GAME_WIDTH, GAME_HEIGHT);
+
+    printf("  \"average_survival_ticks\": {");
+    for (int role = 0; role < ANALYZE_ROLES; role++) {
+        printf("%s\"%s\": %.2f", role ? ", " : "", role_names[role],
+               average(result->survival_ticks[role], result->survival_count[role]));
+    }
+    printf("},\n");
+
+    printf("  \"personalities\": [");
+    for (int p = 0; p < ANALYZE_PERSONALITIES; p++) {
+        printf("%s\n    {\"name\": \"%s\", \"matches\": %u, \"ai_wins\": %u, \"human_wins\": %u, "
+               "\"draws\": %u, \"ai_win_rate\": %.4f}",
+               p ? "," : "", personality_names[p], (unsigned)result->matches[p],
+               (unsigned)result->ai_wins[p], (unsigned)result->human_wins[p], (unsigned)result->draws[p],
+               ratio(result->ai_wins[p], result->matches[p]));
+    }
+    printf("\n  ],\n");
+
+    for (int role = 0; role < ANALYZE_ROLES; role++) {
+        printf("  \"death_heatmap_%s\": ", role_names[role]);
+        print_heatmap_json((uint32_t (*)[GAME_WIDTH])result->deaths[role]);
+        printf(",\n");
+    }
+    printf("  \"apple_heatmap\": ");
+    print_heatmap_json((uint32_t (*)[GAME_WIDTH])result->apples);
+    printf("\n}\n");
+}
+
+/**
+ * @brief CSV 출력 (metric,group,x,y,value - 집계 하나가 한 줄)
+ */
+static void print_csv(const analysis_t* result) {
+    printf("metric,group,x,y,value\n");
+    printf("files,,,,%u\nskipped,,,,%u\nticks,,,,%llu\n",
+           (unsigned)result->files, (unsigned)result->skipped, (unsigned long long)result->ticks);
+
+    for (int role = 0; role < ANALYZE_ROLES; role++) {
+        printf("average_survival_ticks,%s,,,%.2f\n", role_names[role],
+               average(result->survival_ticks[role], result->survival_count[role]));
+    }
+    for (int p = 0; p < ANALYZE_PERSONALITIES; p++) {
+        printf("matches,%s,,,%u\n", personality_names[p], (unsigned)result->matches[p]);
+        printf("ai_wins,%s,,,%u\n", personality_names[p], (unsigned)result->ai_wins[p]);
+        printf("human_wins,%s,,,%u\n", personality_names[p], (unsigned)result->human_wins[p]);
+        printf("draws,%s,,,%u\n", personality_names[p], (unsigned)result->draws[p]);
+        printf("ai_win_rate,%s,,,%.4f\n", personality_names[p], ratio(result->ai_wins[p], result->matches[p]));
+    }
+
+    // 히트맵은 0이 아닌 칸만
+    for (int y = 0; y < GAME_HEIGHT; y++) {
+        for (int x = 0; x < GAME_WIDTH; x++) {
+            for (int role = 0; role < ANALYZE_ROLES; role++) {
+                if (result->deaths[role][y][x]) {
+                    printf("death,%s,%d,%d,%u\n", role_names[role], x, y, (unsigned)result->deaths[role][y][x]);
+                }
+            }
+            if (result->apples[y][x]) {
+                printf("apple,,%d,%d,%u\n", x, y, (unsigned)result->apples[y][x]);
+            }
+        }
+    }
+}
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "사용법: %s [--format json|csv] [--threads N] <디렉터리 또는 .snkr 파일>...\n", program);
+}
+
+int main(int argc, char** argv) {
+    bool csv = false;
+    int threads = 0;
+    corpus_t corpus = {0};
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            const char* format = argv[++i];
+            if (strcmp(format, "csv") == 0) {
+                csv = true;
+            } else if (strcmp(format, "json") != 0) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (argv[i][0] == '-') {
+            print_usage(argv[0]);
+            return 1;
+        } else {
+            // 디렉터리로 읽히지 않으면 파일 하나로 취급
+            directory_scan_t scan = {&corpus, argv[i]};
+            if (!platform_list_directory(argv[i], add_directory_entry, &scan)) {
+                add_path(&corpus, argv[i]);
+            }
+        }
+    }
+    if (corpus.count == 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    uint64_t start_time = platform_get_time_ms();
+
+    thread_pool_t* pool = thread_pool_create(threads);
+    int worker_count = pool && thread_pool_size(pool) > 0 ? thread_pool_size(pool) : 1;
+    if (worker_count > corpus.count) worker_count = corpus.count;
+
+    worker_t* workers = calloc((size_t)worker_count, sizeof(worker_t));
+    future_t** futures = calloc((size_t)worker_count, sizeof(future_t*));
+    analysis_t* total = calloc(1, sizeof(analysis_t));
+    if (!workers || !futures || !total) {
+        fprintf(stderr, "메모리가 부족합니다\n");
+        return 1;
+    }
+
+    for (int i = 0; i < worker_count; i++) {
+        workers[i].corpus = &corpus;
+        futures[i] = pool ? thread_pool_submit(pool, worker_main, &workers[i]) : NULL;
+        if (!futures[i]) {
+            worker_main(&workers[i]);  // 풀 없이 이 스레드에서 처리
+        }
+    }
+    for (int i = 0; i < worker_count; i++) {
+        if (futures[i]) {
+            future_get(futures[i]);
+            future_release(futures[i]);
+        }
+        merge_analysis(total, &workers[i].result);
+    }
+    thread_pool_destroy(pool);
+
+    if (csv) {
+        print_csv(total);
+    } else {
+        print_json(total);
+    }
+
+    fprintf(stderr, "리플레이 %u개 분석, %u개 건너뜀 (작업자 %d개, %llums)\n",
+            (unsigned)total->files, (unsigned)total->skipped, worker_count,
+            (unsigned long long)(platform_get_time_ms() - start_time));
+
+    for (int i = 0; i < corpus.count; i++) {
+        free(corpus.paths[i]);
+    }
+    free(corpus.paths);
+    free(futures);
+    free(workers);
+    free(total);
+    return 0;
+}
@@ -0,0 +1,402 @@
+/**
+ * @file snake_bench.c
+ * @brief 성능 측정 도구
+ *
+ * contention: 스레드 수를 늘려 가며 동기화 기본 요소의 경합 처리량을 잽니다.
+ *             각 항목은 정해진 시간 동안 모든 스레드가 같은 자원을 두드린 횟수를
+ *             초당 연산 수로 출력합니다.
+ * save:       진행 중인 대전 상태를 저장 형식과 키프레임 형식으로 쓰고 읽는
+ *             초당 횟수와 크기를 출력합니다.
+ * capture:    screen_flush_ansi의 프레임당 시간을 asciicast 녹화를 끈 경우와
+ *             켠 경우로 나누어 출력합니다.
+ *
+ * 사용법: snake_bench [contention|save|capture] [--ms 측정 시간]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform/platform.h"
+#include "platform/thread_pool.h"
+#include "platform/screen.h"
+#include "platform/capture.h"
+#include "game/game.h"
+#include "game/ai.h"
+#include "game/save.h"
+
+#define BENCH_MAX_THREADS 64
+#define BENCH_DEFAULT_MS 300
+#define POOL_BATCH 32                  // 풀 측정에서 한 번에 제출하는 작업 수
+#define SAVE_BENCH_SEED 3              // 두 AI가 900틱 가까이 맞붙는 시드
+#define SAVE_BENCH_TICKS 1000          // 측정 전에 진행시킬 틱 수 (뱀이 충분히 길어지도록)
+#define KEYFRAME_MAX_SIZE 65536
+#define CAPTURE_BENCH_PATH "snake_bench_capture.cast"  // 측정이 끝나면 지움
+
+/**
+ * @brief 경합 측정 한 번의 공유 상태
+ */
+typedef struct {
+    volatile int32_t stop;             // 측정 종료 플래그
+    volatile int32_t ready;            // 출발선에 선 스레드 수
+    volatile int64_t ops;              // 모든 스레드의 연산 합계
+    mutex_handle_t mutex;
+    semaphore_handle_t semaphore;
+    thread_pool_t* pool;
+    volatile int32_t counter;
+    int64_t guarded;                   // mutex로만 보호하는 일반 변수
+} contention_t;
+
+typedef int64_t (*bench_loop_t)(contention_t* bench);
+
+typedef struct {
+    contention_t* bench;
+    bench_loop_t loop;
+} bench_worker_t;
+
+static int64_t mutex_loop(contention_t* bench) {
+    int64_t ops = 0;
+    while (!platform_atomic_load(&bench->stop)) {
+        platform_lock_mutex(bench->mutex);
+        bench->guarded++;
+        platform_unlock_mutex(bench->mutex);
+        ops++;
+    }
+    return ops;
+}
+
+static int64_t atomic_loop(contention_t* bench) {
+    int64_t ops = 0;
+    while (!platform_atomic_load(&bench->stop)) {
+        platform_atomic_fetch_add(&bench->counter, 1);
+        ops++;
+    }
+    return ops;
+}
+
+static int64_t cas_loop(contention_t* bench) {
+    int64_t ops = 0;
+    while (!platform_atomic_load(&bench->stop)) {
+        int32_t expected = platform_atomic_load(&bench->counter);
+        while (!platform_atomic_compare_exchange(&bench->counter, &expected, expected + 1)) {
+        }
+        ops++;
+    }
+    return ops;
+}
+
+static int64_t semaphore_loop(contention_t* bench) {
+    int64_t ops = 0;
+    while (!platform_atomic_load(&bench->stop)) {
+        platform_semaphore_wait(bench->semaphore);
+        platform_semaphore_post(bench->semaphore);
+        ops++;
+    }
+    return ops;
+}
+
+static void* empty_task(void* arg) {
+    return arg;
+}
+
+static int64_t pool_loop(contention_t* bench) {
+    int64_t ops = 0;
+    future_t* futures[POOL_BATCH];
+    while (!platform_atomic_load(&bench->stop)) {
+        for (int i = 0; i < POOL_BATCH; i++) {
+            futures[i] = thread_pool_submit(bench->pool, empty_task, NULL);
+        }
+        for (int i = 0; i < POOL_BATCH; i++) {
+            if (!futures[i]) continue;
+            future_get(futures[i]);
+            future_release(futures[i]);
+            ops++;
+        }
+    }
+    return ops;
+}
+
+static void* bench_worker_main(void* arg) {
+    bench_worker_t* worker = (bench_worker_t*)arg;
+    platform_atomic_fetch_add(&worker->bench->ready, 1);
+    platform_atomic_fetch_add64(&worker->bench->ops, worker->loop(worker->bench));
+    return NULL;
+}
+
+/**
+ * @brief 스레드 threads개로 loop를 duration_ms 동안 돌리고 초당 연산 수를 돌려줍니다
+ */
+static double run_contention(bench_loop_t loop, int threads, int duration_ms, int semaphore_permits) {
+    contention_t bench;
+    memset(&bench, 0, sizeof(bench));
+    bench.mutex = platform_create_mutex();
+    bench.semaphore = platform_create_semaphore(semaphore_permits);
+    bench.pool = loop == pool_loop ? thread_pool_create(0) : NULL;
+
+    bench_worker_t worker = {&bench, loop};
+    thread_handle_t handles[BENCH_MAX_THREADS];
+    for (int i = 0; i < threads; i++) {
+        handles[i] = platform_create_thread(bench_worker_main, &worker);
+    }
+    while (platform_atomic_load(&bench.ready) < threads) {
+        platform_sleep(0);
+    }
+
+    uint64_t start = platform_get_time_us();
+    platform_sleep(duration_ms);
+    platform_atomic_store(&bench.stop, 1);
+    for (int i = 0; i < threads; i++) {
+        platform_join_thread(handles[i]);
+    }
+    uint64_t elapsed = platform_get_time_us() - start;
+
+    if (bench.pool) thread_pool_destroy(bench.pool);
+    platform_destroy_semaphore(bench.semaphore);
+    platform_destroy_mutex(bench.mutex);
+
+    return elapsed > 0 ? (double)platform_atomic_load64(&bench.ops) * 1000000.0 / (double)elapsed : 0.0;
+}
+
+/**
+ * @brief 동기화 기본 요소의 경합 처리량을 표로 출력합니다
+ */
+static void bench_contention(int duration_ms) {
+    static const struct {
+        const char* name;
+        bench_loop_t loop;
+    } cases[] = {
+        {"뮤텍스", mutex_loop},
+        {"fetch_add", atomic_loop},
+        {"compare_exchange", cas_loop},
+        {"세마포어(허가 1)", semaphore_loop},
+        {"스레드 풀 submit/get", pool_loop},
+    };
+
+    int max_threads = platform_cpu_count() * 2;
+    if (max_threads < 4) max_threads = 4;
+    if (max_threads > BENCH_MAX_THREADS) max_threads = BENCH_MAX_THREADS;
+
+    printf("경합 처리량 (초당 연산 수, 항목당 %dms)\n", duration_ms);
+    printf("%-24s", "항목");
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        printf(" %10d", threads);
+    }
+    printf("\n");
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        printf("%-24s", cases[i].name);
+        for (int threads = 1; threads <= max_threads; threads *= 2) {
+            printf(" %10.0f", run_contention(cases[i].loop, threads, duration_ms, 1));
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+}
+
+// ========== 저장/불러오기 처리량 ==========
+
+/**
+ * @brief 두 AI가 맞붙은 대전을 일정 틱 진행시켜 측정용 상태를 만듭니다
+ *
+ * 한쪽이 먼저 죽으면 그 시점의 상태를 그대로 씁니다.
+ */
+static bool prepare_save_state(game_state_t* game) {
+    game_clock_t clock;
+    game_clock_init(&clock, GAME_CLOCK_VIRTUAL);
+    if (!game_init_with_seed(game, GAME_MODE_VS_AI_MEDIUM, &clock, SAVE_BENCH_SEED)) return false;
+    game->players[0].type = PLAYER_AI_MEDIUM;
+
+    for (int tick = 0; tick < SAVE_BENCH_TICKS; tick++) {
+        ai_update_players(game, AI_PERSONALITY_BALANCED);
+        game_clock_advance_us(&game->clock, (uint64_t)game->game_speed * 1000);
+        if (!game_update(game)) break;
+    }
+    return true;
+}
+
+/**
+ * @brief 저장 형식과 키프레임 형식의 쓰기/읽기 초당 횟수를 출력합니다
+ */
+static void bench_save(int duration_ms) {
+    static game_state_t game;
+    static game_state_t loaded;
+    static uint8_t save_buffer[SAVE_MAX_SIZE];
+    static uint8_t keyframe_buffer[KEYFRAME_MAX_SIZE];
+
+    if (!prepare_save_state(&game)) {
+        fprintf(stderr, "측정용 게임을 만들 수 없습니다\n");
+        return;
+    }
+
+    size_t save_size = game_save_to_buffer(&game, save_buffer, sizeof(save_buffer));
+    size_t keyframe_size = game_serialize_state(&game, keyframe_buffer, sizeof(keyframe_buffer));
+    printf("측정 상태: 틱 %u, 뱀 길이 %d/%d\n", game.tick_count,
+           game.players[0].length, game.players[1].length);
+
+    uint64_t budget_us = (uint64_t)duration_ms * 1000;
+    static const char* names[4] = {"save 쓰기", "save 읽기", "키프레임 쓰기", "키프레임 읽기"};
+    size_t sizes[4] = {save_size, save_size, keyframe_size, keyframe_size};
+
+    printf("%-20s %12s %10s\n", "항목", "초당 횟수", "바이트");
+    for (int item = 0; item < 4; item++) {
+        if (sizes[item] == 0) {
+            printf("%-20s %12s\n", names[item], "실패");
+            continue;
+        }
+
+        int64_t ops = 0;
+        bool ok = true;
+        uint64_t start = platform_get_time_us();
+        uint64_t elapsed = 0;
+        while (ok && elapsed < budget_us) {
+            // 시계 확인 비용이 섞이지 않도록 64번씩 묶어 잼
+            for (int i = 0; i < 64 && ok; i++) {
+                switch (item) {
+                    case 0:
+                        ok = game_save_to_buffer(&game, save_buffer, sizeof(save_buffer)) == save_size;
+                        break;
+                    case 1:
+                        ok = game_load_from_buffer(&loaded, &game.clock, save_buffer, save_size);
+                        game_cleanup(&loaded);
+                        break;
+                    case 2:
+                        ok = game_serialize_state(&game, keyframe_buffer, sizeof(keyframe_buffer)) == keyframe_size;
+                        break;
+                    default:
+                        ok = game_deserialize_state(&game, keyframe_buffer, keyframe_size);
+                        break;
+                }
+                ops++;
+            }
+            elapsed = platform_get_time_us() - start;
+        }
+
+        if (!ok) {
+            printf("%-20s %12s\n", names[item], "실패");
+        } else {
+            printf("%-20s %12.0f %10zu\n", names[item],
+                   elapsed > 0 ? (double)ops * 1000000.0 / (double)elapsed : 0.0, sizes[item]);
+        }
+    }
+
+    game_cleanup(&game);
+}
+
+// ========== 녹화 부하 ==========
+
+static size_t g_flushed_bytes = 0;
+
+/**
+ * @brief 터미널 대신 바이트 수만 세고, 유닉스 백엔드처럼 녹화에도 넘깁니다
+ */
+static void bench_terminal_write(const char* data, size_t len) {
+    g_flushed_bytes += len;
+    capture_output(data, len);
+}
+
+/**
+ * @brief y번째 줄을 프레임마다 다른 내용(한글과 ASCII 섞음)으로 채웁니다
+ */
+static void draw_bench_row(int y, int frame) {
+    char line[SCREEN_WIDTH * 3 + 1];
+    int n = snprintf(line, sizeof(line), "%*s점수 %6d ", (frame + y) % 10, "", frame * 10 + y);
+    int columns = n - 2;  // 한글 두 글자는 6바이트, 4칸
+    while (columns < SCREEN_WIDTH - 1 && n < (int)sizeof(line) - 1) {
+        line[n++] = (char)('#' + (frame + columns) % 4);
+        columns++;
+    }
+    line[n] = '\0';
+    platform_print_at(0, y, line);
+}
+
+/**
+ * @brief duration_ms 동안 그리기와 screen_flush_ansi를 반복하고 프레임당 마이크로초를 돌려줍니다
+ */
+static double run_flush_frames(int duration_ms, bool full_frame) {
+    uint64_t budget_us = (uint64_t)duration_ms * 1000;
+    uint64_t start = platform_get_time_us();
+    uint64_t elapsed = 0;
+    int frames = 0;
+
+    while (elapsed < budget_us) {
+        for (int i = 0; i < 16; i++) {
+            frames++;
+            if (full_frame) {
+                for (int y = 0; y < SCREEN_HEIGHT; y++) {
+                    draw_bench_row(y, frames);
+                }
+            } else {
+                draw_bench_row(SCREEN_HEIGHT / 2, frames);
+            }
+            screen_flush_ansi(bench_terminal_write);
+        }
+        elapsed = platform_get_time_us() - start;
+    }
+    return (double)elapsed / frames;
+}
+
+/**
+ * @brief 녹화를 끈 경우와 켠 경우의 화면 출력 시간을 비교해 출력합니다
+ */
+static void bench_capture(int duration_ms) {
+    static const struct {
+        const char* name;
+        bool full_frame;
+    } cases[] = {
+        {"화면 전체 변경", true},
+        {"한 줄 변경", false},
+    };
+
+    screen_init();
+    printf("그리기와 screen_flush_ansi의 프레임당 시간 (us, 항목당 %dms)\n", duration_ms);
+    printf("%-20s %12s %12s %10s\n", "항목", "녹화 끔", "녹화 켬", "증가");
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        screen_invalidate();
+        double off = run_flush_frames(duration_ms, cases[i].full_frame);
+
+        if (!capture_start(CAPTURE_BENCH_PATH, SCREEN_WIDTH, SCREEN_HEIGHT)) {
+            fprintf(stderr, "%s에 녹화할 수 없습니다\n", CAPTURE_BENCH_PATH);
+            return;
+        }
+        screen_invalidate();
+        double on = run_flush_frames(duration_ms, cases[i].full_frame);
+        capture_stop();
+
+        printf("%-20s %12.2f %12.2f %9.1f%%\n", cases[i].name, off, on,
+               off > 0.0 ? (on - off) * 100.0 / off : 0.0);
+    }
+    remove(CAPTURE_BENCH_PATH);
+}
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "사용법: %s [contention|save|capture] [--ms 측정 시간]\n", program);
+}
+
+int main(int argc, char** argv) {
+    const char* mode = "contention";
+    int duration_ms = BENCH_DEFAULT_MS;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ms") == 0 && i + 1 < argc) {
+            duration_ms = atoi(argv[++i]);
+            if (duration_ms <= 0) duration_ms = BENCH_DEFAULT_MS;
+        } else if (argv[i][0] != '-') {
+            mode = argv[i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (strcmp(mode, "contention") == 0) {
+        bench_contention(duration_ms);
+    } else if (strcmp(mode, "save") == 0) {
+        bench_save(duration_ms);
+    } else if (strcmp(mode, "capture") == 0) {
+        bench_capture(duration_ms);
+    } else {
+        print_usage(argv[0]);
+        return 1;
+    }
+    return 0;
+}
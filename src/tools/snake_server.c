@@ -0,0 +1,1379 @@
+/**
+ * @file snake_server.c
+ * @brief 여러 클라이언트의 대전을 한 스케줄러에서 진행하는 락스텝 서버
+ *
+ * 이벤트 대기기(Linux는 epoll) 하나로 모든 연결을 처리합니다. 두 클라이언트가
+ * HELLO를 보내면 대전이 시작되고, 대전마다 자기 game_speed 간격으로 틱을 진행하며
+ * 그 틱에 적용한 방향 전환만 양쪽에 보냅니다 (netplay.h). 대전별 다음 틱은
+ * 타이머 휠에 예약하고, 같은 때 만료된 대전들의 game_update는 작업자 스레드들이
+ * 나눠 실행합니다. 클라이언트마다 버퍼 크기가 정해져 있어, 받는 속도를
+ * 따라오지 못하는 클라이언트는 끊습니다.
+ *
+ * SPECTATE를 보낸 연결은 관전자가 됩니다. 관전자가 있는 대전은 틱마다 바뀐 칸만
+ * 담은 프레임을 한 번 만들어 참조 수로 공유하고, 모든 관전자가 그 버퍼를 복사하지
+ * 않고 그대로 보냅니다. 늦게 온 관전자는 가장 최근 KEY 프레임과 그 뒤의 DELTA를
+ * 받습니다. 관전자마다 보낼 프레임 큐 크기가 정해져 있어, 큐가 넘치면 끊지 않고
+ * 밀린 프레임을 버린 뒤 KEY부터 다시 받게 합니다.
+ *
+ * 사용법:
+ *   snake_server [--listen 주소] [--workers N]         서버 (기본 127.0.0.1:7777, 작업자는 CPU 수)
+ *   snake_server --connect 주소 --bots N [--spectators S] [--matches M] [--verify]
+ *                                                      부하/검증용 봇 클라이언트 N개와 관전 봇 S개
+ *   주소는 "호스트:포트" 또는 "unix:경로"
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform/platform.h"
+#include "platform/thread_pool.h"
+#include "platform/timer_wheel.h"
+#include "game/game.h"
+#include "game/netplay.h"
+
+#define SERVER_MAX_EVENTS 256          // 한 번에 처리하는 소켓 이벤트 수
+#define CLIENT_IN_BUFFER 64            // 클라이언트별 받기 버퍼 (메시지 몇 개 분량)
+#define CLIENT_OUT_BUFFER 1024         // 클라이언트별 보내기 버퍼 (틱 100개 이상 분량)
+#define CLIENT_TURN_QUEUE 4            // 아직 적용하지 않은 방향 전환 최대 수
+#define STATS_INTERVAL_US 5000000      // 통계 출력 간격
+#define BOT_IDLE_TIMEOUT_US 10000000   // 봇이 아무 메시지도 받지 못하면 포기하는 시간
+#define SERVER_MAX_WORKERS 64          // 시뮬레이션 작업자 최대 수
+#define TICK_BATCH_MIN 64              // 작업자 하나에 맡기는 최소 대전 수 (적으면 직접 진행)
+#define LATENCY_BUCKETS 25             // 틱 지연 분포 구간 수 (약 16초까지)
+#define SPECTATOR_QUEUE 64             // 관전자별 아직 보내지 못한 프레임 최대 수
+#define SPECTATOR_KEYFRAME_INTERVAL 32 // 이 틱 수마다 늦게 온 관전자용 KEY 프레임을 새로 만듦
+
+// 재동기화는 보내던 프레임 하나와 KEY, 그 뒤의 DELTA를 한 번에 큐에 넣음
+#if SPECTATOR_QUEUE < SPECTATOR_KEYFRAME_INTERVAL + 2
+#error "SPECTATOR_QUEUE가 KEY 프레임 간격보다 커야 합니다"
+#endif
+
+typedef struct match match_t;
+
+/**
+ * @brief 관전자들이 함께 보내는 프레임 (한 번 만들고 참조 수로 공유)
+ *
+ * 작업자는 새 프레임을 만들기만 하고, 참조 수는 이벤트 루프 스레드에서만 바꿉니다.
+ */
+typedef struct {
+    int refs;
+    size_t size;
+    uint8_t data[];
+} frame_t;
+
+/**
+ * @brief 클라이언트 연결 상태
+ */
+typedef enum {
+    CLIENT_LOBBY,                  // 연결됨, HELLO 전
+    CLIENT_WAITING,                // 상대를 기다리는 중
+    CLIENT_PLAYING,                // 대전 중
+    CLIENT_SPECTATING,             // 관전 연결 (대전에 참가하지 않음)
+    CLIENT_CLOSING                 // 이번 이벤트 묶음이 끝나면 해제
+} client_state_t;
+
+/**
+ * @brief 서버 쪽 클라이언트 하나
+ */
+typedef struct client {
+    int socket;
+    client_state_t state;
+    match_t* match;                // 대전 중이거나 관전 중이면 그 대전
+    int player_id;                 // 대전에서의 플레이어 번호
+    uint8_t in[CLIENT_IN_BUFFER];  // 아직 해석하지 않은 받은 바이트
+    size_t in_used;
+    uint8_t out[CLIENT_OUT_BUFFER];  // 아직 보내지 못한 바이트
+    size_t out_used;
+    bool want_write;               // 쓰기 이벤트를 기다리는 중
+    uint8_t turns[CLIENT_TURN_QUEUE];  // 다음 틱들에 적용할 방향
+    int turn_count;
+    struct client* next_closed;    // 해제 대기 목록
+
+    // 관전
+    struct client* spectate_prev;  // 같은 대전(또는 관전 대기열)의 관전자 목록
+    struct client* spectate_next;
+    frame_t* frames[SPECTATOR_QUEUE];  // 보낼 프레임 (원형 큐, 프레임마다 참조 하나)
+    int frame_head;
+    int frame_count;
+    size_t frame_offset;           // 맨 앞 프레임에서 이미 보낸 바이트 수
+} client_t;
+
+/**
+ * @brief 진행 중인 대전 하나
+ */
+struct match {
+    game_state_t game;
+    uint32_t id;                   // 관전할 때 고르는 대전 번호
+    match_t* prev;                 // 진행 중인 대전 목록 (최근 대전이 앞)
+    match_t* next;
+    client_t* players[MAX_PLAYERS];
+    timer_node_t timer;            // 다음 틱 예약 (user는 이 대전)
+    uint64_t next_tick_us;         // 다음 틱 예정 시각 (지연 측정 기준)
+    uint8_t events[MAX_PLAYERS];   // 이번 틱에 적용할 방향 전환
+    int event_count;
+    bool running;                  // 이번 틱 뒤에도 계속되는지 (작업자가 씀)
+
+    // 관전 (관전자가 없으면 프레임을 만들지 않음)
+    client_t* spectators;
+    int spectator_count;
+    frame_t* keyframe;             // 가장 최근 KEY 프레임
+    frame_t* history[SPECTATOR_KEYFRAME_INTERVAL];  // keyframe 뒤의 DELTA
+    int history_count;
+    frame_t* delta;                // 작업자가 이번 틱에 만든 DELTA
+    frame_t* next_keyframe;        // 작업자가 이번 틱에 만든 KEY (간격이 찼을 때만)
+    char shadow[GAME_HEIGHT][GAME_WIDTH];  // 관전자들에게 보낸 맵
+};
+
+/**
+ * @brief 틱 지연 분포 (2의 거듭제곱 마이크로초 구간)
+ */
+typedef struct {
+    uint64_t counts[LATENCY_BUCKETS];
+    uint64_t total;
+    uint64_t max_us;
+} latency_histogram_t;
+
+/**
+ * @brief 서버 전체 상태 (단일 스레드)
+ */
+typedef struct {
+    net_poller_t* poller;
+    int listener;
+    client_t* waiting;             // 상대를 기다리는 클라이언트 (없으면 NULL)
+    client_t* closed;              // 이번 이벤트 묶음에서 끊은 클라이언트
+    match_t* matches;              // 진행 중인 대전 (최근 대전이 앞)
+    client_t* spectators_waiting;  // 다음 대전을 기다리는 관전자
+    timer_wheel_t wheel;           // 대전별 다음 틱 예약
+    thread_pool_t* pool;           // 시뮬레이션 작업자
+    match_t** due;                 // 이번에 만료된 대전 (대전 수만큼 확보)
+    int due_count;
+    int due_capacity;
+    int match_count;               // 진행 중인 대전 수
+    uint32_t next_seed;            // 대전마다 다른 시드
+    uint32_t next_match_id;
+
+    // 통계
+    int clients;
+    uint64_t ticks;
+    uint64_t bytes_sent;
+    uint64_t matches_finished;
+    uint64_t slow_disconnects;
+    int spectators;                // 관전 연결 수
+    uint64_t frames_built;
+    uint64_t frame_bytes;          // 만든 프레임 크기 합 (보낸 양은 관전자 수만큼 곱해짐)
+    uint64_t spectator_resyncs;    // 큐가 넘쳐 KEY부터 다시 보낸 횟수
+    latency_histogram_t latency;   // 통계 구간의 틱 지연
+    uint64_t worst_match_latency_us;  // 통계 구간에 끝난 대전들의 최대 지연 중 최댓값
+} server_t;
+
+// ========== 서버: 관전 프레임 ==========
+
+/**
+ * @brief 인코딩한 바이트로 참조 수 1인 프레임을 만듭니다 (작업자에서도 호출)
+ */
+static frame_t* frame_create(const uint8_t* data, size_t size) {
+    frame_t* frame = malloc(sizeof(frame_t) + size);
+    if (!frame) return NULL;
+    frame->refs = 1;
+    frame->size = size;
+    memcpy(frame->data, data, size);
+    return frame;
+}
+
+static frame_t* frame_retain(frame_t* frame) {
+    frame->refs++;
+    return frame;
+}
+
+static void frame_release(frame_t* frame) {
+    if (frame && --frame->refs == 0) {
+        free(frame);
+    }
+}
+
+// ========== 서버: 연결 ==========
+
+static void close_client(server_t* server, client_t* client);
+
+/**
+ * @brief 보내기 버퍼의 내용을 가능한 만큼 소켓으로 보냅니다
+ */
+static void flush_client(server_t* server, client_t* client) {
+    if (client->state == CLIENT_CLOSING) return;
+
+    if (client->out_used > 0) {
+        long sent = platform_net_send(client->socket, client->out, client->out_used);
+        if (sent == NET_ERROR) {
+            close_client(server, client);
+            return;
+        }
+
+        server->bytes_sent += (uint64_t)sent;
+        client->out_used -= (size_t)sent;
+        if (client->out_used > 0 && sent > 0) {
+            memmove(client->out, client->out + sent, client->out_used);
+        }
+    }
+
+    // 관전 프레임은 공유 버퍼에서 바로 보냄
+    while (client->frame_count > 0) {
+        frame_t* frame = client->frames[client->frame_head];
+        long sent = platform_net_send(client->socket, frame->data + client->frame_offset,
+                                      frame->size - client->frame_offset);
+        if (sent == NET_ERROR) {
+            close_client(server, client);
+            return;
+        }
+
+        server->bytes_sent += (uint64_t)sent;
+        client->frame_offset += (size_t)sent;
+        if (client->frame_offset < frame->size) break;
+
+        frame_release(frame);
+        client->frame_head = (client->frame_head + 1) % SPECTATOR_QUEUE;
+        client->frame_count--;
+        client->frame_offset = 0;
+    }
+
+    // 다 못 보냈을 때만 쓰기 이벤트를 기다림 (평소에는 poller를 건드리지 않음)
+    bool want_write = client->out_used > 0 || client->frame_count > 0;
+    if (want_write != client->want_write) {
+        client->want_write = want_write;
+        platform_poller_modify(server->poller, client->socket,
+                               NET_EVENT_READ | (want_write ? NET_EVENT_WRITE : 0), client);
+    }
+}
+
+/**
+ * @brief 메시지를 보내기 버퍼에 넣고 바로 보내 봅니다
+ *
+ * 버퍼가 넘치면 받는 속도를 따라오지 못하는 클라이언트이므로 끊습니다.
+ */
+static void send_message(server_t* server, client_t* client, const uint8_t* data, size_t size) {
+    if (client->state == CLIENT_CLOSING) return;
+    if (client->out_used + size > CLIENT_OUT_BUFFER) {
+        server->slow_disconnects++;
+        close_client(server, client);
+        return;
+    }
+
+    memcpy(client->out + client->out_used, data, size);
+    client->out_used += size;
+    if (!client->want_write) {
+        flush_client(server, client);
+    }
+}
+
+// ========== 서버: 관전 ==========
+
+/**
+ * @brief 관전자가 들어 있는 목록 (대전을 보는 중이면 그 대전, 아니면 대기열)
+ */
+static client_t** spectator_list(server_t* server, client_t* client) {
+    return client->match ? &client->match->spectators : &server->spectators_waiting;
+}
+
+static void spectator_link(client_t** list, client_t* client) {
+    client->spectate_prev = NULL;
+    client->spectate_next = *list;
+    if (*list) (*list)->spectate_prev = client;
+    *list = client;
+}
+
+/**
+ * @brief 관전자를 보던 대전이나 대기열에서 뺍니다 (어디에도 없으면 아무 일도 안 함)
+ */
+static void spectator_unlink(server_t* server, client_t* client) {
+    client_t** list = spectator_list(server, client);
+    if (!client->spectate_prev && *list != client) return;
+
+    if (client->spectate_prev) {
+        client->spectate_prev->spectate_next = client->spectate_next;
+    } else {
+        *list = client->spectate_next;
+    }
+    if (client->spectate_next) {
+        client->spectate_next->spectate_prev = client->spectate_prev;
+    }
+    client->spectate_prev = NULL;
+    client->spectate_next = NULL;
+
+    if (client->match) {
+        client->match->spectator_count--;
+        client->match = NULL;
+    }
+}
+
+static bool spectator_enqueue(client_t* client, frame_t* frame) {
+    if (client->frame_count == SPECTATOR_QUEUE) return false;
+    client->frames[(client->frame_head + client->frame_count) % SPECTATOR_QUEUE] = frame_retain(frame);
+    client->frame_count++;
+    return true;
+}
+
+/**
+ * @brief 아직 보내지 않은 프레임을 버립니다
+ *
+ * @param keep_partial 보내던 프레임은 남김 (스트림 중간에서 끊기지 않도록)
+ */
+static void spectator_drop_frames(client_t* client, bool keep_partial) {
+    int keep = keep_partial && client->frame_offset > 0 ? 1 : 0;
+    for (int i = keep; i < client->frame_count; i++) {
+        frame_release(client->frames[(client->frame_head + i) % SPECTATOR_QUEUE]);
+    }
+    client->frame_count = keep;
+    if (!keep) client->frame_offset = 0;
+}
+
+/**
+ * @brief 밀린 프레임을 버리고 가장 최근 KEY와 그 뒤의 DELTA를 큐에 넣습니다
+ *
+ * 늦게 들어온 관전자와 큐가 넘친 관전자 모두 이 방법으로 현재 틱을 따라잡습니다.
+ */
+static void spectator_resync(client_t* client, const match_t* match) {
+    spectator_drop_frames(client, true);
+    spectator_enqueue(client, match->keyframe);
+    for (int i = 0; i < match->history_count; i++) {
+        spectator_enqueue(client, match->history[i]);
+    }
+}
+
+/**
+ * @brief 대전의 관전 프레임을 만들기 시작합니다 (첫 관전자가 들어올 때)
+ */
+static bool start_match_frames(server_t* server, match_t* match) {
+    uint8_t buffer[NETPLAY_MAX_FRAME];
+    size_t size = netplay_encode_keyframe(buffer, &match->game, match->id);
+    match->keyframe = frame_create(buffer, size);
+    if (!match->keyframe) return false;
+
+    memcpy(match->shadow, match->game.map, sizeof(match->shadow));
+    match->history_count = 0;
+    server->frames_built++;
+    server->frame_bytes += size;
+    return true;
+}
+
+static void stop_match_frames(match_t* match) {
+    frame_release(match->keyframe);
+    for (int i = 0; i < match->history_count; i++) {
+        frame_release(match->history[i]);
+    }
+    match->keyframe = NULL;
+    match->history_count = 0;
+}
+
+static void spectator_attach(server_t* server, client_t* client, match_t* match) {
+    if (!match->keyframe && !start_match_frames(server, match)) {
+        close_client(server, client);
+        return;
+    }
+
+    client->match = match;
+    spectator_link(&match->spectators, client);
+    match->spectator_count++;
+    spectator_resync(client, match);
+    flush_client(server, client);
+}
+
+/**
+ * @brief 작업자가 만든 이번 틱의 DELTA를 모든 관전자에게 나눠 줍니다
+ *
+ * 프레임은 참조만 늘려 큐에 넣으므로 관전자 수와 관계없이 한 번만 만들고 복사하지 않습니다.
+ */
+static void publish_match_frames(server_t* server, match_t* match) {
+    frame_t* delta = match->delta;
+    frame_t* keyframe = match->next_keyframe;
+    match->delta = NULL;
+    match->next_keyframe = NULL;
+
+    if (delta) {
+        server->frames_built++;
+        server->frame_bytes += delta->size;
+    }
+    if (keyframe) {
+        server->frames_built++;
+        server->frame_bytes += keyframe->size;
+    }
+
+    // 관전자가 모두 떠났으면 프레임 만들기를 멈춤
+    if (match->spectator_count == 0) {
+        frame_release(delta);
+        frame_release(keyframe);
+        stop_match_frames(match);
+        return;
+    }
+
+    // 메모리가 부족해 이번 틱을 놓쳤으면 관전자들은 이어 받을 수 없으므로 끊음
+    if (!delta || (!keyframe && match->history_count + 1 >= SPECTATOR_KEYFRAME_INTERVAL)) {
+        frame_release(delta);
+        frame_release(keyframe);
+        while (match->spectators) {
+            close_client(server, match->spectators);
+        }
+        stop_match_frames(match);
+        return;
+    }
+
+    if (keyframe) {
+        stop_match_frames(match);
+        match->keyframe = keyframe;
+    } else {
+        match->history[match->history_count++] = frame_retain(delta);
+    }
+
+    for (client_t* client = match->spectators; client;) {
+        client_t* next = client->spectate_next;
+        if (!spectator_enqueue(client, delta)) {
+            spectator_resync(client, match);
+            server->spectator_resyncs++;
+        }
+        if (!client->want_write) {
+            flush_client(server, client);
+        }
+        client = next;
+    }
+    frame_release(delta);
+}
+
+/**
+ * @brief 대전이 끝났음을 관전자들에게 알리고 대전에서 떼어 냅니다
+ */
+static void finish_match_spectators(server_t* server, match_t* match, int winner_id) {
+    if (!match->spectators) return;
+
+    uint8_t buffer[NETPLAY_MAX_FRAME];
+    frame_t* end = frame_create(buffer, netplay_encode_frame_end(buffer, &match->game, winner_id));
+
+    while (match->spectators) {
+        client_t* client = match->spectators;
+        if (!end) {
+            close_client(server, client);
+            continue;
+        }
+        if (!spectator_enqueue(client, end)) {
+            spectator_resync(client, match);
+            spectator_enqueue(client, end);
+            server->spectator_resyncs++;
+        }
+        spectator_unlink(server, client);
+        flush_client(server, client);
+    }
+    frame_release(end);
+}
+
+// ========== 서버: 대전 ==========
+
+/**
+ * @brief 틱 지연(예정 시각보다 늦게 시작한 정도)을 기록합니다
+ */
+static void record_latency(latency_histogram_t* histogram, uint64_t latency_us) {
+    int bucket = 0;
+    while (bucket < LATENCY_BUCKETS - 1 && (latency_us >> bucket) > 0) {
+        bucket++;
+    }
+    histogram->counts[bucket]++;
+    histogram->total++;
+    if (latency_us > histogram->max_us) {
+        histogram->max_us = latency_us;
+    }
+}
+
+/**
+ * @brief 전체 틱 중 ratio만큼이 넘지 않는 지연의 상한 (마이크로초)
+ */
+static uint64_t latency_percentile(const latency_histogram_t* histogram, double ratio) {
+    uint64_t target = (uint64_t)((double)histogram->total * ratio);
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        seen += histogram->counts[bucket];
+        if (seen > target) {
+            return bucket == 0 ? 0 : (1ull << bucket) - 1;
+        }
+    }
+    return histogram->max_us;
+}
+
+/**
+ * @brief 대전의 다음 틱을 타이머 휠에 예약합니다
+ */
+static void schedule_match(server_t* server, match_t* match) {
+    timer_wheel_schedule(&server->wheel, &match->timer, (match->next_tick_us + 999) / 1000);
+}
+
+static void remove_match(server_t* server, match_t* match) {
+    timer_wheel_cancel(&server->wheel, &match->timer);
+    server->match_count--;
+    if (match->prev) {
+        match->prev->next = match->next;
+    } else {
+        server->matches = match->next;
+    }
+    if (match->next) {
+        match->next->prev = match->prev;
+    }
+    stop_match_frames(match);
+
+    // 대전별 최악 지연 (한 대전이라도 굶었는지 확인용)
+    if (match->game.tick_stats.max_jitter_us > server->worst_match_latency_us) {
+        server->worst_match_latency_us = match->game.tick_stats.max_jitter_us;
+    }
+    game_cleanup(&match->game);
+    free(match);
+}
+
+/**
+ * @brief 대전을 끝내고 남은 클라이언트에게 결과를 보냅니다
+ *
+ * @param winner_id 승자 (기권이면 남은 플레이어, 정상 종료면 game의 승자)
+ */
+static void finish_match(server_t* server, match_t* match, int winner_id) {
+    uint8_t message[NETPLAY_MAX_MESSAGE];
+    size_t size = netplay_encode_end(message, &match->game, winner_id);
+
+    for (int i = 0; i < match->game.num_players; i++) {
+        client_t* client = match->players[i];
+        if (!client) continue;
+        client->match = NULL;
+        client->turn_count = 0;
+        if (client->state == CLIENT_PLAYING) {
+            client->state = CLIENT_LOBBY;
+            send_message(server, client, message, size);
+        }
+    }
+    finish_match_spectators(server, match, winner_id);
+
+    server->matches_finished++;
+    remove_match(server, match);
+}
+
+static void start_match(server_t* server, client_t* first, client_t* second) {
+    // 한 번에 모든 대전이 만료될 수 있으므로 만료 목록은 대전 수만큼 미리 확보
+    if (server->match_count == server->due_capacity) {
+        int capacity = server->due_capacity ? server->due_capacity * 2 : 64;
+        match_t** due = realloc(server->due, (size_t)capacity * sizeof(match_t*));
+        if (!due) {
+            close_client(server, first);
+            close_client(server, second);
+            return;
+        }
+        server->due = due;
+        server->due_capacity = capacity;
+    }
+
+    match_t* match = calloc(1, sizeof(match_t));
+    server->next_seed = server->next_seed * 1664525u + 1013904223u;
+    if (!match || !netplay_match_init(&match->game, server->next_seed)) {
+        free(match);
+        close_client(server, first);
+        close_client(server, second);
+        return;
+    }
+
+    match->id = ++server->next_match_id;
+    match->players[0] = first;
+    match->players[1] = second;
+    match->timer.user = match;
+    match->next = server->matches;
+    if (server->matches) server->matches->prev = match;
+    server->matches = match;
+    match->next_tick_us = platform_get_time_us() + (uint64_t)match->game.game_speed * 1000;
+    server->match_count++;
+    schedule_match(server, match);
+
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        client_t* client = match->players[i];
+        uint8_t message[NETPLAY_MAX_MESSAGE];
+        client->state = CLIENT_PLAYING;
+        client->match = match;
+        client->player_id = i;
+        client->turn_count = 0;
+        send_message(server, client, message, netplay_encode_start(message, match->game.seed, i, MAX_PLAYERS));
+    }
+
+    // 다음 대전을 기다리던 관전자들은 이 대전을 봄
+    while (server->spectators_waiting) {
+        client_t* client = server->spectators_waiting;
+        spectator_unlink(server, client);
+        spectator_attach(server, client, match);
+    }
+}
+
+/**
+ * @brief 만료된 대전을 이번 틱 목록에 넣습니다 (timer_wheel_advance 콜백)
+ */
+static void collect_due_match(timer_node_t* timer, void* context) {
+    server_t* server = (server_t*)context;
+    server->due[server->due_count++] = (match_t*)timer->user;
+}
+
+/**
+ * @brief 틱의 네트워크 쪽 절반: 플레이어마다 방향 전환을 최대 하나 골라 보냅니다
+ *
+ * 클라이언트도 같은 이벤트로 netplay_advance를 호출하므로 상태가 같게 유지됩니다.
+ *
+ * @return 시뮬레이션을 진행해야 하면 true (기권으로 끝났으면 false)
+ */
+static bool prepare_match_tick(server_t* server, match_t* match, uint64_t now_us) {
+    game_state_t* game = &match->game;
+
+    // 연결이 끊긴 플레이어가 있으면 기권: 남은 플레이어의 승리
+    int remaining = 0;
+    int winner_id = -1;
+    for (int i = 0; i < game->num_players; i++) {
+        if (match->players[i]) {
+            remaining++;
+            winner_id = i;
+        }
+    }
+    if (remaining < game->num_players) {
+        finish_match(server, match, remaining == 1 ? winner_id : -1);
+        return false;
+    }
+
+    uint64_t latency_us = now_us > match->next_tick_us ? now_us - match->next_tick_us : 0;
+    record_latency(&server->latency, latency_us);
+    game_record_tick_jitter(game, latency_us);
+
+    match->event_count = 0;
+    for (int i = 0; i < game->num_players; i++) {
+        client_t* client = match->players[i];
+        int used = 0;
+        while (used < client->turn_count) {
+            direction_t direction = (direction_t)client->turns[used++];
+            if (netplay_is_turn(game, i, direction)) {
+                match->events[match->event_count++] = (uint8_t)(i << 2 | direction);
+                break;
+            }
+        }
+        client->turn_count -= used;
+        memmove(client->turns, client->turns + used, (size_t)client->turn_count);
+    }
+
+    uint8_t message[NETPLAY_MAX_MESSAGE];
+    size_t size = netplay_encode_tick(message, game->tick_count, match->events, match->event_count);
+    for (int i = 0; i < game->num_players; i++) {
+        if (match->players[i]) {
+            send_message(server, match->players[i], message, size);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 작업자 하나가 맡는 대전 묶음
+ */
+typedef struct {
+    match_t** matches;
+    int count;
+} tick_batch_t;
+
+/**
+ * @brief 틱의 시뮬레이션 쪽 절반 (대전끼리 공유하는 상태가 없어 작업자에서 실행)
+ */
+/**
+ * @brief 관전자가 있는 대전의 이번 틱 프레임을 만듭니다 (작업자에서 실행)
+ *
+ * 참조 수는 건드리지 않고 새 프레임만 만들어 두면, 이벤트 루프가 publish_match_frames에서 나눠 줍니다.
+ */
+static void encode_match_frames(match_t* match) {
+    uint8_t buffer[NETPLAY_MAX_FRAME];
+    size_t size = netplay_encode_delta(buffer, &match->game, &match->shadow[0][0]);
+    match->delta = frame_create(buffer, size);
+
+    if (match->history_count + 1 >= SPECTATOR_KEYFRAME_INTERVAL) {
+        size = netplay_encode_keyframe(buffer, &match->game, match->id);
+        match->next_keyframe = frame_create(buffer, size);
+    }
+}
+
+static void* simulate_batch(void* arg) {
+    tick_batch_t* batch = (tick_batch_t*)arg;
+    for (int i = 0; i < batch->count; i++) {
+        match_t* match = batch->matches[i];
+        match->running = netplay_advance(&match->game, match->events, match->event_count);
+        if (match->keyframe) {
+            encode_match_frames(match);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 만료된 대전들의 시뮬레이션을 작업자들에게 나눠 맡기고 모두 끝날 때까지 기다립니다
+ */
+static void simulate_due_matches(server_t* server, match_t** matches, int count) {
+    int workers = server->pool ? thread_pool_size(server->pool) : 0;
+    int batches = count / TICK_BATCH_MIN;
+    if (batches > workers) batches = workers;
+    if (batches > SERVER_MAX_WORKERS) batches = SERVER_MAX_WORKERS;
+
+    if (batches <= 1) {
+        tick_batch_t batch = {matches, count};
+        simulate_batch(&batch);
+        return;
+    }
+
+    tick_batch_t batch[SERVER_MAX_WORKERS];
+    future_t* futures[SERVER_MAX_WORKERS];
+    int start = 0;
+    for (int i = 0; i < batches; i++) {
+        int end = (int)((int64_t)count * (i + 1) / batches);
+        batch[i].matches = matches + start;
+        batch[i].count = end - start;
+        futures[i] = thread_pool_submit(server->pool, simulate_batch, &batch[i]);
+        if (!futures[i]) simulate_batch(&batch[i]);  // 제출 실패 시 이 스레드에서
+        start = end;
+    }
+    for (int i = 0; i < batches; i++) {
+        if (futures[i]) {
+            future_get(futures[i]);
+            future_release(futures[i]);
+        }
+    }
+}
+
+/**
+ * @brief 예정 시각이 된 대전의 틱을 진행하고, 다음 틱까지 남은 시간을 돌려줍니다
+ *
+ * 타이머 휠에서 만료된 대전만 꺼내므로 대전 수와 관계없이 만료된 만큼만 일합니다.
+ * 보내기와 받기는 이 스레드가, 시뮬레이션은 작업자들이 나눠서 합니다.
+ *
+ * @return 다음 틱까지 밀리초 (대전이 없으면 -1)
+ */
+static int run_due_matches(server_t* server) {
+    uint64_t now_us = platform_get_time_us();
+    server->due_count = 0;
+    timer_wheel_advance(&server->wheel, now_us / 1000, collect_due_match, server);
+
+    int count = 0;
+    for (int i = 0; i < server->due_count; i++) {
+        if (prepare_match_tick(server, server->due[i], now_us)) {
+            server->due[count++] = server->due[i];
+        }
+    }
+
+    simulate_due_matches(server, server->due, count);
+    server->ticks += (uint64_t)count;
+
+    for (int i = 0; i < count; i++) {
+        match_t* match = server->due[i];
+        if (match->keyframe) {
+            publish_match_frames(server, match);
+        }
+        if (!match->running) {
+            finish_match(server, match, match->game.winner_id);
+            continue;
+        }
+        // 틱 도중 연결이 끊겨 이미 기권 처리가 예약됐으면 그대로 둠
+        if (timer_wheel_pending(&match->timer)) continue;
+
+        // 밀렸으면 몰아서 따라잡지 않고 지금부터 다시 간격을 잼
+        match->next_tick_us += (uint64_t)match->game.game_speed * 1000;
+        if (match->next_tick_us < now_us) {
+            match->next_tick_us = now_us;
+        }
+        schedule_match(server, match);
+    }
+
+    uint64_t next_ms = timer_wheel_next_expiry(&server->wheel);
+    if (next_ms == UINT64_MAX) return -1;
+
+    uint64_t now_ms = platform_get_time_us() / 1000;
+    return next_ms <= now_ms ? 0 : (int)(next_ms - now_ms);
+}
+
+// ========== 서버: 메시지 처리 ==========
+
+static void close_client(server_t* server, client_t* client) {
+    if (client->state == CLIENT_CLOSING) return;
+
+    if (server->waiting == client) {
+        server->waiting = NULL;
+    }
+    if (client->state == CLIENT_SPECTATING) {
+        spectator_unlink(server, client);
+        spectator_drop_frames(client, false);
+        server->spectators--;
+    }
+    client->state = CLIENT_CLOSING;
+    if (client->match) {
+        // 대전은 틱 도중일 수 있으므로 바로 끝내지 않고 곧바로 돌아올 틱에서 기권 처리
+        client->match->players[client->player_id] = NULL;
+        timer_wheel_schedule(&server->wheel, &client->match->timer, 0);
+        client->match = NULL;
+    }
+
+    platform_poller_remove(server->poller, client->socket);
+    platform_net_close(client->socket);
+    client->socket = -1;
+    client->next_closed = server->closed;
+    server->closed = client;
+    server->clients--;
+}
+
+static void handle_message(server_t* server, client_t* client, const netplay_message_t* message) {
+    switch (message->type) {
+        case NETPLAY_MSG_HELLO:
+            if (message->version != NETPLAY_VERSION) {
+                close_client(server, client);
+            } else if (client->state == CLIENT_LOBBY) {
+                if (server->waiting) {
+                    client_t* opponent = server->waiting;
+                    server->waiting = NULL;
+                    start_match(server, opponent, client);
+                } else {
+                    client->state = CLIENT_WAITING;
+                    server->waiting = client;
+                }
+            }
+            break;
+
+        case NETPLAY_MSG_SPECTATE: {
+            // 대전 참가자는 관전할 수 없음
+            if (client->state != CLIENT_LOBBY && client->state != CLIENT_SPECTATING) break;
+            if (client->state == CLIENT_LOBBY) {
+                client->state = CLIENT_SPECTATING;
+                server->spectators++;
+            }
+
+            match_t* match = server->matches;
+            while (match && message->match_id != 0 && match->id != message->match_id) {
+                match = match->next;
+            }
+            if (!match && message->match_id != 0) {
+                close_client(server, client);  // 없거나 이미 끝난 대전
+                break;
+            }
+
+            // 보던 대전을 바꾸면 새 대전의 KEY부터 받음
+            spectator_unlink(server, client);
+            if (match) {
+                spectator_attach(server, client, match);
+            } else {
+                spectator_link(&server->spectators_waiting, client);
+            }
+            break;
+        }
+
+        case NETPLAY_MSG_TURN:
+            // 대전 중이 아니거나 대기열이 차면 버림 (클라이언트별 메모리 고정)
+            if (client->state == CLIENT_PLAYING && client->turn_count < CLIENT_TURN_QUEUE) {
+                client->turns[client->turn_count++] = message->direction;
+            }
+            break;
+
+        default:
+            close_client(server, client);  // 서버가 보내는 종류
+            break;
+    }
+}
+
+static void read_client(server_t* server, client_t* client) {
+    long received = platform_net_recv(client->socket, client->in + client->in_used,
+                                      CLIENT_IN_BUFFER - client->in_used);
+    if (received == NET_AGAIN) return;
+    if (received <= 0) {
+        close_client(server, client);
+        return;
+    }
+    client->in_used += (size_t)received;
+
+    size_t offset = 0;
+    while (client->state != CLIENT_CLOSING) {
+        netplay_message_t message;
+        size_t used = netplay_decode(client->in + offset, client->in_used - offset, &message);
+        if (used == 0) break;
+        if (used == NETPLAY_MALFORMED) {
+            close_client(server, client);
+            return;
+        }
+        offset += used;
+        handle_message(server, client, &message);
+    }
+
+    client->in_used -= offset;
+    memmove(client->in, client->in + offset, client->in_used);
+}
+
+static void accept_clients(server_t* server) {
+    for (;;) {
+        int socket = platform_net_accept(server->listener);
+        if (socket < 0) return;
+
+        client_t* client = calloc(1, sizeof(client_t));
+        if (!client || !platform_poller_add(server->poller, socket, NET_EVENT_READ, client)) {
+            free(client);
+            platform_net_close(socket);
+            continue;
+        }
+        client->socket = socket;
+        client->state = CLIENT_LOBBY;
+        server->clients++;
+    }
+}
+
+static int run_server(const char* address, int workers) {
+    server_t server;
+    memset(&server, 0, sizeof(server));
+    server.next_seed = (uint32_t)platform_get_time_us();
+    timer_wheel_init(&server.wheel, platform_get_time_us() / 1000);
+    server.pool = thread_pool_create(workers);
+
+    server.poller = platform_poller_create();
+    server.listener = platform_net_listen(address);
+    if (!server.poller || server.listener < 0 ||
+        !platform_poller_add(server.poller, server.listener, NET_EVENT_READ, NULL)) {
+        fprintf(stderr, "%s에서 연결을 받을 수 없습니다\n", address);
+        return 1;
+    }
+    fprintf(stderr, "%s에서 연결을 기다립니다 (시뮬레이션 작업자 %d개)\n", address,
+            server.pool ? thread_pool_size(server.pool) : 0);
+
+    net_event_t events[SERVER_MAX_EVENTS];
+    uint64_t last_stats = platform_get_time_us();
+    uint64_t last_ticks = 0;
+
+    for (;;) {
+        int timeout_ms = run_due_matches(&server);
+        int count = platform_poller_wait(server.poller, events, SERVER_MAX_EVENTS, timeout_ms);
+        if (count < 0) break;
+
+        for (int i = 0; i < count; i++) {
+            client_t* client = (client_t*)events[i].user;
+            if (!client) {
+                accept_clients(&server);
+                continue;
+            }
+            if (client->state == CLIENT_CLOSING) continue;
+
+            if (events[i].events & NET_EVENT_WRITE) {
+                flush_client(&server, client);
+            }
+            if (client->state != CLIENT_CLOSING && (events[i].events & (NET_EVENT_READ | NET_EVENT_HANGUP))) {
+                read_client(&server, client);
+            }
+        }
+
+        // 이벤트 묶음 안에서 끊은 클라이언트는 이제 해제해도 안전
+        while (server.closed) {
+            client_t* next = server.closed->next_closed;
+            free(server.closed);
+            server.closed = next;
+        }
+
+        uint64_t now = platform_get_time_us();
+        if (now - last_stats >= STATS_INTERVAL_US) {
+            fprintf(stderr, "연결 %d, 대전 %d, 틱/초 %.0f, 보낸 바이트 %llu, 끝난 대전 %llu, 느려서 끊음 %llu\n",
+                    server.clients, server.match_count,
+                    (double)(server.ticks - last_ticks) * 1000000.0 / (double)(now - last_stats),
+                    (unsigned long long)server.bytes_sent, (unsigned long long)server.matches_finished,
+                    (unsigned long long)server.slow_disconnects);
+            fprintf(stderr, "  틱 지연 p50 <=%lluus, p99 <=%lluus, p99.9 <=%lluus, 최대 %lluus, 끝난 대전별 최대 지연 중 최댓값 %lluus\n",
+                    (unsigned long long)latency_percentile(&server.latency, 0.5),
+                    (unsigned long long)latency_percentile(&server.latency, 0.99),
+                    (unsigned long long)latency_percentile(&server.latency, 0.999),
+                    (unsigned long long)server.latency.max_us,
+                    (unsigned long long)server.worst_match_latency_us);
+            if (server.spectators > 0 || server.frames_built > 0) {
+                fprintf(stderr, "  관전 연결 %d, 만든 프레임 %llu (%llu바이트), 관전 재동기화 %llu\n",
+                        server.spectators, (unsigned long long)server.frames_built,
+                        (unsigned long long)server.frame_bytes, (unsigned long long)server.spectator_resyncs);
+            }
+            memset(&server.latency, 0, sizeof(server.latency));
+            server.worst_match_latency_us = 0;
+            last_ticks = server.ticks;
+            last_stats = now;
+        }
+    }
+
+    thread_pool_destroy(server.pool);
+    platform_net_close(server.listener);
+    platform_poller_destroy(server.poller);
+    return 1;
+}
+
+// ========== 봇 클라이언트 ==========
+
+/**
+ * @brief 부하/검증용 봇 하나
+ *
+ * 검증 모드에서는 서버가 보낸 이벤트로 자기 게임을 진행하고,
+ * 끝날 때 서버의 상태 해시와 비교합니다. 관전 봇은 받은 프레임으로 맵을
+ * 다시 만들고 끝날 때 서버의 맵 해시와 비교합니다.
+ */
+typedef struct {
+    int socket;
+    bool connected;
+    bool playing;
+    int player_id;
+    uint8_t in[CLIENT_IN_BUFFER];
+    size_t in_used;
+    game_state_t* game;            // 검증 모드에서만 할당
+    int matches_left;
+    uint32_t rng;                  // 방향 전환 난수
+
+    // 관전 봇 (playing은 대전을 보는 중)
+    bool spectator;
+    uint8_t* frames;               // 받은 프레임 바이트 (NETPLAY_MAX_FRAME)
+    size_t frames_used;
+    char* map;                     // 프레임으로 다시 만든 맵
+    bool synced;                   // KEY를 받아 맵이 유효함
+    uint32_t frame_tick;           // 마지막으로 적용한 프레임의 틱
+} bot_t;
+
+/**
+ * @brief 봇 전체 결과
+ */
+typedef struct {
+    net_poller_t* poller;
+    bool verify;
+    int active;                    // 아직 연결된 봇 수
+    int players;                   // 아직 연결된 대전 봇 수
+    int player_bots;               // 처음 띄운 대전 봇 수 (0이면 관전 봇만 실행)
+    uint64_t matches;
+    uint64_t verified;
+    uint64_t desyncs;
+    uint64_t ticks;
+    uint64_t watched;              // 관전 봇이 끝까지 본 대전
+    uint64_t frames;
+    uint64_t frame_errors;         // 틱이 건너뛰었거나 맵 해시가 다른 경우
+} bot_fleet_t;
+
+static uint32_t bot_random(bot_t* bot) {
+    bot->rng ^= bot->rng << 13;
+    bot->rng ^= bot->rng >> 17;
+    bot->rng ^= bot->rng << 5;
+    return bot->rng;
+}
+
+static void bot_send(bot_t* bot, const uint8_t* data, size_t size) {
+    // 보내는 양이 아주 적으므로 버퍼가 차면 그 입력은 버림
+    platform_net_send(bot->socket, data, size);
+}
+
+static void bot_disconnect(bot_fleet_t* fleet, bot_t* bot) {
+    if (bot->socket < 0) return;
+    platform_poller_remove(fleet->poller, bot->socket);
+    platform_net_close(bot->socket);
+    bot->socket = -1;
+    fleet->active--;
+    if (!bot->spectator) fleet->players--;
+    if (bot->game && bot->playing) {
+        game_cleanup(bot->game);
+    }
+    bot->playing = false;
+    free(bot->game);
+    bot->game = NULL;
+    free(bot->frames);
+    bot->frames = NULL;
+    free(bot->map);
+    bot->map = NULL;
+}
+
+static void bot_handle_message(bot_fleet_t* fleet, bot_t* bot, const netplay_message_t* message) {
+    uint8_t out[NETPLAY_MAX_MESSAGE];
+
+    switch (message->type) {
+        case NETPLAY_MSG_START:
+            bot->player_id = message->player_id;
+            if (fleet->verify) {
+                if (!bot->game) bot->game = malloc(sizeof(game_state_t));
+                if (!bot->game || !netplay_match_init(bot->game, message->seed)) {
+                    bot_disconnect(fleet, bot);
+                    break;
+                }
+            }
+            bot->playing = true;
+            break;
+
+        case NETPLAY_MSG_TICK:
+            fleet->ticks++;
+            if (bot->game && bot->playing) {
+                netplay_advance(bot->game, message->events, message->event_count);
+            }
+            // 평균 여덟 틱에 한 번 아무 방향으로나 꺾음
+            if ((bot_random(bot) & 7) == 0) {
+                bot_send(bot, out, netplay_encode_turn(out, (direction_t)(bot_random(bot) & 3)));
+            }
+            break;
+
+        case NETPLAY_MSG_END:
+            fleet->matches++;
+            if (bot->game && bot->playing) {
+                fleet->verified++;
+                if (bot->game->tick_count != message->tick || game_state_hash(bot->game) != message->hash) {
+                    fleet->desyncs++;
+                }
+                game_cleanup(bot->game);
+            }
+            bot->playing = false;
+            if (--bot->matches_left > 0) {
+                bot_send(bot, out, netplay_encode_hello(out));
+            } else {
+                bot_disconnect(fleet, bot);
+            }
+            break;
+
+        default:
+            bot_disconnect(fleet, bot);
+            break;
+    }
+}
+
+static void bot_read(bot_fleet_t* fleet, bot_t* bot) {
+    long received = platform_net_recv(bot->socket, bot->in + bot->in_used, CLIENT_IN_BUFFER - bot->in_used);
+    if (received == NET_AGAIN) return;
+    if (received <= 0) {
+        bot_disconnect(fleet, bot);
+        return;
+    }
+    bot->in_used += (size_t)received;
+
+    size_t offset = 0;
+    while (bot->socket >= 0) {
+        netplay_message_t message;
+        size_t used = netplay_decode(bot->in + offset, bot->in_used - offset, &message);
+        if (used == 0) break;
+        if (used == NETPLAY_MALFORMED) {
+            bot_disconnect(fleet, bot);
+            return;
+        }
+        offset += used;
+        bot_handle_message(fleet, bot, &message);
+    }
+
+    bot->in_used -= offset;
+    memmove(bot->in, bot->in + offset, bot->in_used);
+}
+
+/**
+ * @brief 관전 봇이 받은 프레임 하나를 맵에 적용합니다
+ */
+static void spectator_handle_frame(bot_fleet_t* fleet, bot_t* bot, const netplay_frame_t* frame) {
+    uint8_t out[NETPLAY_MAX_MESSAGE];
+
+    switch (frame->type) {
+        case NETPLAY_FRAME_KEY:
+            // 처음 들어왔거나 큐가 넘쳐 다시 맞추는 중
+            if (!netplay_apply_frame(bot->map, frame)) {
+                fleet->frame_errors++;
+                bot_disconnect(fleet, bot);
+                return;
+            }
+            bot->synced = true;
+            bot->playing = true;
+            bot->frame_tick = frame->tick;
+            fleet->frames++;
+            break;
+
+        case NETPLAY_FRAME_DELTA:
+            if (!bot->synced || frame->tick != bot->frame_tick + 1 || !netplay_apply_frame(bot->map, frame)) {
+                fleet->frame_errors++;
+                bot_disconnect(fleet, bot);
+                return;
+            }
+            bot->frame_tick = frame->tick;
+            fleet->frames++;
+            break;
+
+        case NETPLAY_FRAME_END:
+            if (bot->synced) {
+                fleet->watched++;
+                if (frame->tick != bot->frame_tick || netplay_map_hash(bot->map) != frame->map_hash) {
+                    fleet->frame_errors++;
+                }
+            }
+            bot->synced = false;
+            bot->playing = false;
+            // 대전 봇이 모두 끝났으면 더 볼 대전이 없음
+            if (--bot->matches_left > 0 && (fleet->player_bots == 0 || fleet->players > 0)) {
+                bot_send(bot, out, netplay_encode_spectate(out, 0));
+            } else {
+                bot_disconnect(fleet, bot);
+            }
+            break;
+    }
+}
+
+static void spectator_read(bot_fleet_t* fleet, bot_t* bot) {
+    long received = platform_net_recv(bot->socket, bot->frames + bot->frames_used,
+                                      NETPLAY_MAX_FRAME - bot->frames_used);
+    if (received == NET_AGAIN) return;
+    if (received <= 0) {
+        bot_disconnect(fleet, bot);
+        return;
+    }
+    bot->frames_used += (size_t)received;
+
+    size_t offset = 0;
+    while (bot->socket >= 0) {
+        netplay_frame_t frame;
+        size_t used = netplay_decode_frame(bot->frames + offset, bot->frames_used - offset, &frame);
+        if (used == 0) break;
+        if (used == NETPLAY_MALFORMED) {
+            fleet->frame_errors++;
+            bot_disconnect(fleet, bot);
+            return;
+        }
+        offset += used;
+        spectator_handle_frame(fleet, bot, &frame);
+    }
+
+    if (bot->socket < 0) return;
+    bot->frames_used -= offset;
+    memmove(bot->frames, bot->frames + offset, bot->frames_used);
+}
+
+static int run_bots(const char* address, int count, int spectators, int matches, bool verify) {
+    bot_fleet_t fleet;
+    memset(&fleet, 0, sizeof(fleet));
+    fleet.verify = verify;
+    fleet.player_bots = count;
+    fleet.poller = platform_poller_create();
+    int total = count + spectators;
+    bot_t* bots = calloc((size_t)total, sizeof(bot_t));
+    if (!fleet.poller || !bots) {
+        fprintf(stderr, "봇을 준비할 수 없습니다\n");
+        return 1;
+    }
+
+    for (int i = 0; i < total; i++) {
+        bot_t* bot = &bots[i];
+        if (i >= count) {
+            bot->spectator = true;
+            bot->frames = malloc(NETPLAY_MAX_FRAME);
+            bot->map = malloc(NETPLAY_MAP_CELLS);
+            if (!bot->frames || !bot->map) {
+                free(bot->frames);
+                free(bot->map);
+                bot->frames = NULL;
+                bot->map = NULL;
+                bot->socket = -1;
+                continue;
+            }
+        }
+        bot->socket = platform_net_connect(address);
+        bot->matches_left = matches;
+        bot->rng = 0x9E3779B9u * (uint32_t)(i + 1);
+        // 연결이 끝나면 쓰기 가능 이벤트가 옴
+        if (bot->socket < 0 || !platform_poller_add(fleet.poller, bot->socket, NET_EVENT_WRITE, bot)) {
+            fprintf(stderr, "%s에 연결할 수 없습니다\n", address);
+            platform_net_close(bot->socket);
+            bot->socket = -1;
+            continue;
+        }
+        fleet.active++;
+        if (!bot->spectator) fleet.players++;
+    }
+
+    uint64_t start_time = platform_get_time_us();
+    uint64_t last_activity = start_time;
+    net_event_t events[SERVER_MAX_EVENTS];
+    while (fleet.active > 0) {
+        int ready = platform_poller_wait(fleet.poller, events, SERVER_MAX_EVENTS, 1000);
+        if (ready < 0) break;
+
+        // 상대가 없어 짝을 못 찾은 봇 등으로 한동안 아무 일도 없으면 끝냄
+        uint64_t now = platform_get_time_us();
+        if (ready > 0) {
+            last_activity = now;
+        } else if (now - last_activity > BOT_IDLE_TIMEOUT_US) {
+            fprintf(stderr, "응답이 없어 봇 %d개를 남기고 끝냅니다\n", fleet.active);
+            break;
+        }
+
+        for (int i = 0; i < ready; i++) {
+            bot_t* bot = (bot_t*)events[i].user;
+            if (bot->socket < 0) continue;
+
+            if (!bot->connected && (events[i].events & NET_EVENT_WRITE)) {
+                uint8_t hello[NETPLAY_MAX_MESSAGE];
+                bot->connected = true;
+                platform_poller_modify(fleet.poller, bot->socket, NET_EVENT_READ, bot);
+                bot_send(bot, hello, bot->spectator ? netplay_encode_spectate(hello, 0) : netplay_encode_hello(hello));
+            }
+            if (events[i].events & (NET_EVENT_READ | NET_EVENT_HANGUP)) {
+                if (bot->spectator) {
+                    spectator_read(&fleet, bot);
+                } else {
+                    bot_read(&fleet, bot);
+                }
+            }
+        }
+
+        // 대전 봇이 모두 끝나면 다음 대전을 기다리던 관전 봇도 끝냄
+        if (fleet.player_bots > 0 && fleet.players == 0) {
+            for (int i = count; i < total; i++) {
+                if (bots[i].socket >= 0 && !bots[i].playing) {
+                    bot_disconnect(&fleet, &bots[i]);
+                }
+            }
+        }
+    }
+
+    double seconds = (double)(platform_get_time_us() - start_time) / 1000000.0;
+    printf("봇 %d개, 끝난 대전 %llu, 받은 틱 %llu (%.1f초)\n", count,
+           (unsigned long long)fleet.matches, (unsigned long long)fleet.ticks, seconds);
+    if (verify) {
+        printf("상태 해시 검증 %llu, 어긋남 %llu\n",
+               (unsigned long long)fleet.verified, (unsigned long long)fleet.desyncs);
+    }
+    if (spectators > 0) {
+        printf("관전 봇 %d개, 끝까지 본 대전 %llu, 받은 프레임 %llu, 맵 어긋남 %llu\n", spectators,
+               (unsigned long long)fleet.watched, (unsigned long long)fleet.frames,
+               (unsigned long long)fleet.frame_errors);
+    }
+
+    for (int i = 0; i < total; i++) {
+        bot_disconnect(&fleet, &bots[i]);
+    }
+    free(bots);
+    platform_poller_destroy(fleet.poller);
+    return fleet.desyncs == 0 && fleet.frame_errors == 0 ? 0 : 2;
+}
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "사용법: %s [--listen 주소] [--workers N]\n", program);
+    fprintf(stderr, "        %s --connect 주소 --bots N [--spectators S] [--matches M] [--verify]\n", program);
+}
+
+int main(int argc, char** argv) {
+    const char* listen_address = NETPLAY_DEFAULT_ADDRESS;
+    const char* connect_address = NULL;
+    int bots = 1;
+    int spectators = 0;
+    int matches = 1;
+    bool verify = false;
+    int workers = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--listen") == 0 && i + 1 < argc) {
+            listen_address = argv[++i];
+        } else if (strcmp(argv[i], "--connect") == 0 && i + 1 < argc) {
+            connect_address = argv[++i];
+        } else if (strcmp(argv[i], "--bots") == 0 && i + 1 < argc) {
+            bots = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--spectators") == 0 && i + 1 < argc) {
+            spectators = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--matches") == 0 && i + 1 < argc) {
+            matches = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            verify = true;
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (connect_address) {
+        if (bots < 0 || spectators < 0 || bots + spectators < 1 || matches < 1) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        return run_bots(connect_address, bots, spectators, matches, verify);
+    }
+    return run_server(listen_address, workers);
+}
@@ -3,19 +3,21 @@
 #include <string.h>
 #include <stdio.h>
 
-// UI 상태 추적을 위한 정적 변수들
-static ui_state_t g_previous_ui_state = UI_STATE_MAIN_MENU;
-static int g_previous_selected_option = -1;
-static char g_previous_title[128] = {0};
-static char g_previous_message[512] = {0};
-static menu_option_t g_previous_options[10];
-static int g_previous_num_options = 0;
-static bool g_ui_initialized = false;
-
 // 정적 함수 선언
 static void ui_handle_main_menu_selection(ui_context_t* ui);
 static void ui_handle_ai_difficulty_selection(ui_context_t* ui);
 static void ui_handle_game_over_selection(ui_context_t* ui);
+static void format_speed_option(ui_context_t* ui);
+static void format_personality_option(ui_context_t* ui);
+
+// 메인 메뉴 옵션 값 (이어하기는 저장된 게임이 있을 때만 종료 앞에 보임)
+enum {
+    MAIN_MENU_SINGLE,
+    MAIN_MENU_SPEED,
+    MAIN_MENU_VS_AI,
+    MAIN_MENU_RESUME,
+    MAIN_MENU_EXIT
+};
 
 /**
  * @brief UI 시스템을 초기화합니다
@@ -33,15 +35,6 @@ void ui_init(ui_context_t* ui) {
     ui->game_speed_setting = 1;    // 보통
     ui->ai_personality = 0;        // 균형잡힌
     
-    // UI 추적 변수 초기화
-    g_ui_initialized = false;
-    g_previous_ui_state = UI_STATE_MAIN_MENU;
-    g_previous_selected_option = -1;
-    memset(g_previous_title, 0, sizeof(g_previous_title));
-    memset(g_previous_message, 0, sizeof(g_previous_message));
-    memset(g_previous_options, 0, sizeof(g_previous_options));
-    g_previous_num_options = 0;
-    
     ui_show_main_menu(ui);
 }
 
@@ -52,7 +45,6 @@ void ui_init(ui_context_t* ui) {
  */
 void ui_cleanup(ui_context_t* ui) {
     (void)ui; // 정리할 리소스가 없음
-    g_ui_initialized = false;
 }
 
 /**
@@ -66,167 +58,152 @@ void ui_update(ui_context_t* ui) {
 }
 
 /**
- * @brief 문자열이 변경되었는지 확인하는 헬퍼 함수
+ * @brief 전체 화면을 완전히 정리하는 함수
  */
-static bool string_changed(const char* current, const char* previous) {
-    return strcmp(current, previous) != 0;
+static void clear_full_screen(void) {
+    // 모든 플랫폼에서 가상 화면이 함께 비워지므로 추가 공백 출력은 불필요
+    platform_clear_screen();
 }
 
 /**
- * @brief 옵션 배열이 변경되었는지 확인하는 헬퍼 함수
+ * @brief 다시 그려야 할 영역을 표시합니다
+ * 
+ * @param ui UI 컨텍스트 포인터
+ * @param regions UI_DIRTY_* 플래그 조합
  */
-static bool options_changed(const menu_option_t* current, const menu_option_t* previous, int current_num, int previous_num) {
-    if (current_num != previous_num) return true;
-    
-    for (int i = 0; i < current_num; i++) {
-        if (strcmp(current[i].text, previous[i].text) != 0 || current[i].value != previous[i].value) {
-            return true;
-        }
+static void mark_dirty(ui_context_t* ui, uint32_t regions) {
+    ui->dirty |= regions;
+    if (regions & UI_DIRTY_SCREEN) {
+        ui->dirty_options = (uint16_t)((1u << UI_MAX_OPTIONS) - 1);
     }
-    return false;
 }
 
 /**
- * @brief 화면의 특정 영역을 지우는 헬퍼 함수
+ * @brief 옵션 한 줄을 다시 그리도록 표시합니다
+ * 
+ * @param ui UI 컨텍스트 포인터
+ * @param index 옵션 인덱스
+ */
+static void mark_option_dirty(ui_context_t* ui, int index) {
+    if (index < 0 || index >= UI_MAX_OPTIONS) return;
+    ui->dirty |= UI_DIRTY_OPTIONS;
+    ui->dirty_options |= (uint16_t)(1u << index);
+}
+
+/**
+ * @brief 메시지를 화면 줄 단위로 나눕니다
+ * 
+ * 빈 줄은 건너뛰며 최대 UI_MAX_MESSAGE_LINES 줄까지만 표시합니다.
+ * 
+ * @param ui UI 컨텍스트 포인터
  */
-static void clear_area(int start_x, int start_y, int width, int height) {
-    platform_set_color(COLOR_BLACK);
-    for (int y = start_y; y < start_y + height; y++) {
-        for (int x = start_x; x < start_x + width; x++) {
-            platform_print_at(x, y, " ");
+static void layout_message(ui_context_t* ui) {
+    memcpy(ui->message_layout, ui->message, sizeof(ui->message_layout));
+    ui->message_layout[sizeof(ui->message_layout) - 1] = '\0';
+    ui->message_line_count = 0;
+    
+    char* cursor = ui->message_layout;
+    while (*cursor && ui->message_line_count < UI_MAX_MESSAGE_LINES) {
+        char* end = strchr(cursor, '\n');
+        if (end) *end = '\0';
+        
+        if (*cursor) {
+            ui->message_lines[ui->message_line_count++] = (uint16_t)(cursor - ui->message_layout);
         }
+        if (!end) break;
+        cursor = end + 1;
     }
 }
 
 /**
- * @brief 전체 화면을 완전히 정리하는 함수
+ * @brief 옵션 한 줄을 그립니다
+ * 
+ * @param ui UI 컨텍스트 포인터
+ * @param index 옵션 인덱스
  */
-static void clear_full_screen(void) {
-    platform_clear_screen();
-
-    // 추가로 전체 화면을 공백으로 채워서 확실하게 정리
-    platform_set_color(COLOR_BLACK);
-    for (int y = 0; y < 50; y++) {
-        for (int x = 0; x < 120; x++) {
-            platform_print_at(x, y, " ");
-        }
+static void render_option(const ui_context_t* ui, int index) {
+    int y = 8 + index * 2;
+    
+    // 선택된 옵션에 화살표 표시
+    if (index == ui->selected_option) {
+        platform_set_color(COLOR_BRIGHT_YELLOW);
+        platform_print_at(25, y, "> ");
     }
+    
+    // 옵션 텍스트 색상 설정
+    platform_set_color(index == ui->selected_option ? COLOR_BRIGHT_WHITE : COLOR_WHITE);
+    platform_print_at(27, y, ui->options[index].text);
 }
 
 /**
- * @brief UI를 화면에 렌더링합니다 (차분 렌더링 적용)
+ * @brief UI를 화면에 렌더링합니다
+ *
+ * 입력 처리나 상태 전환이 표시한 영역만 가상 화면에 다시 그립니다.
+ * 바뀐 것이 없으면 아무 일도 하지 않으므로 매 프레임 호출해도 됩니다.
  *
  * @param ui UI 컨텍스트 포인터
  */
 void ui_render(ui_context_t* ui) {
-    if (!ui) return;
-
-    bool force_full_redraw = false;
-
-    // 첫 렌더링이거나 UI 상태가 변경된 경우 전체 다시 그리기
-    if (!g_ui_initialized || ui->current_state != g_previous_ui_state) {
-        clear_full_screen();  // 완전한 화면 정리
-        platform_hide_cursor();
-        force_full_redraw = true;
-        g_ui_initialized = true;
-        g_previous_ui_state = ui->current_state;
-
-        // 상태 변경시 이전 추적 데이터 모두 리셋
-        memset(g_previous_title, 0, sizeof(g_previous_title));
-        memset(g_previous_message, 0, sizeof(g_previous_message));
-        memset(g_previous_options, 0, sizeof(g_previous_options));
-        g_previous_num_options = 0;
-        g_previous_selected_option = -1;
+    if (!ui || !ui->dirty) return;
+    
+    uint32_t dirty = ui->dirty;
+    
+    if (dirty & UI_DIRTY_SCREEN) {
+        clear_full_screen();
     }
-
-    // 제목 업데이트 (변경된 경우만)
-    if (force_full_redraw || string_changed(ui->title, g_previous_title)) {
-        // 제목을 더 잘 보이는 색상으로 설정
+    
+    // 제목을 더 잘 보이는 색상으로 설정
+    if (dirty & UI_DIRTY_TITLE) {
+        platform_clear_line(2);
         platform_set_color(COLOR_BRIGHT_CYAN);
-
-        // 이전 제목 영역 지우기 (필요한 경우)
-        if (!force_full_redraw) {
-            clear_area(15, 2, 70, 1);
-        }
-
         platform_print_at(20, 2, ui->title);
-        strcpy(g_previous_title, ui->title);
     }
-
-    // 메뉴 옵션들 업데이트 (변경된 경우만)
-    bool options_need_update = force_full_redraw ||
-                              options_changed(ui->options, g_previous_options, ui->num_options, g_previous_num_options) ||
-                              ui->selected_option != g_previous_selected_option;
-
-    if (options_need_update) {
-        // 이전 옵션 영역 지우기 (필요한 경우)
-        if (!force_full_redraw) {
-            int max_options = (g_previous_num_options > ui->num_options) ? g_previous_num_options : ui->num_options;
-            clear_area(25, 8, 60, max_options * 2);
-        }
-
-        // 새 옵션들 그리기
-        for (int i = 0; i < ui->num_options; i++) {
-            int y = 8 + i * 2;
-
-            // 선택된 옵션에 화살표 표시
-            if (i == ui->selected_option) {
-                platform_set_color(COLOR_BRIGHT_YELLOW);
-                platform_print_at(25, y, "> ");
-            } else {
-                platform_print_at(25, y, "  ");
+    
+    // 메뉴 옵션들 그리기 (바뀐 줄만)
+    if (dirty & UI_DIRTY_OPTIONS) {
+        for (int i = 0; i < UI_MAX_OPTIONS; i++) {
+            if (!(ui->dirty_options & (1u << i))) continue;
+            
+            if (!(dirty & UI_DIRTY_SCREEN)) {
+                platform_clear_line(8 + i * 2);
+            }
+            if (i < ui->num_options) {
+                render_option(ui, i);
             }
-
-            // 옵션 텍스트 색상 설정
-            platform_set_color(i == ui->selected_option ? COLOR_BRIGHT_WHITE : COLOR_WHITE);
-            platform_print_at(27, y, ui->options[i].text);
         }
-
-        // 현재 옵션 상태를 이전 상태로 저장
-        memcpy(g_previous_options, ui->options, sizeof(menu_option_t) * ui->num_options);
-        g_previous_num_options = ui->num_options;
-        g_previous_selected_option = ui->selected_option;
     }
-
-    // 메시지 업데이트 (변경된 경우만)
-    if (force_full_redraw || string_changed(ui->message, g_previous_message)) {
-        // 이전 메시지 영역 지우기 (필요한 경우)
-        if (!force_full_redraw) {
-            clear_area(10, 20, 80, 8);
-        }
-
-        if (strlen(ui->message) > 0) {
-            platform_set_color(COLOR_BRIGHT_CYAN);
-
-            char message_copy[1024];
-            strncpy(message_copy, ui->message, sizeof(message_copy) - 1);
-            message_copy[sizeof(message_copy) - 1] = '\0';
-
-            char* line = strtok(message_copy, "\n");
-            int line_y = 20;
-
-            while (line != NULL && line_y < 28) {
-                platform_print_at(10, line_y, line);
-                line = strtok(NULL, "\n");
-                line_y++;
+    
+    // 메시지 그리기 (내용이 바뀐 경우에만 줄 나누기)
+    if (dirty & UI_DIRTY_MESSAGE) {
+        layout_message(ui);
+        if (!(dirty & UI_DIRTY_SCREEN)) {
+            for (int y = 20; y < 20 + UI_MAX_MESSAGE_LINES; y++) {
+                platform_clear_line(y);
             }
         }
-
-        strcpy(g_previous_message, ui->message);
+        
+        platform_set_color(COLOR_BRIGHT_CYAN);
+        for (int i = 0; i < ui->message_line_count; i++) {
+            platform_print_at(10, 20 + i, ui->message_layout + ui->message_lines[i]);
+        }
     }
-
-    // 조작 방법 안내 (한 번만 출력)
-    if (force_full_redraw) {
+    
+    // 조작 방법 안내
+    if (dirty & UI_DIRTY_HINTS) {
+        platform_clear_line(29);
+        platform_clear_line(30);
         platform_set_color(COLOR_BRIGHT_BLACK);
         platform_print_at(20, 29, "화살표 키로 이동, Enter로 선택, ESC로 뒤로가기");
         if (ui->current_state == UI_STATE_MAIN_MENU || ui->current_state == UI_STATE_AI_DIFFICULTY_SELECT) {
             platform_print_at(20, 30, "좌우 화살표로 설정 변경");
         }
     }
-
+    
     platform_reset_color();
+    ui->dirty = 0;
+    ui->dirty_options = 0;
     
-    // Windows에서 더블 버퍼링된 화면을 실제 콘솔에 출력
+    // 가상 화면의 변경분만 실제 화면에 출력
     platform_present_buffer();
 }
 
@@ -239,6 +216,8 @@ void ui_render(ui_context_t* ui) {
 void ui_handle_input(ui_context_t* ui, game_key_t key) {
     if (!ui) return;
     
+    int previous_option = ui->selected_option;
+    
     switch (key) {
         case KEY_UP:
             // 위로 이동 (순환)
@@ -247,6 +226,8 @@ void ui_handle_input(ui_context_t* ui, game_key_t key) {
             } else {
                 ui->selected_option = ui->num_options - 1;
             }
+            mark_option_dirty(ui, previous_option);
+            mark_option_dirty(ui, ui->selected_option);
             break;
             
         case KEY_DOWN:
@@ -256,6 +237,8 @@ void ui_handle_input(ui_context_t* ui, game_key_t key) {
             } else {
                 ui->selected_option = 0;
             }
+            mark_option_dirty(ui, previous_option);
+            mark_option_dirty(ui, ui->selected_option);
             break;
             
         case KEY_LEFT:
@@ -263,11 +246,13 @@ void ui_handle_input(ui_context_t* ui, game_key_t key) {
             if (ui->current_state == UI_STATE_MAIN_MENU && ui->selected_option == 1) {
                 // 게임 속도 변경
                 ui->game_speed_setting = (ui->game_speed_setting == 0) ? 2 : ui->game_speed_setting - 1;
-                ui_show_main_menu(ui);
+                format_speed_option(ui);
+                mark_option_dirty(ui, 1);
             } else if (ui->current_state == UI_STATE_AI_DIFFICULTY_SELECT && ui->selected_option == 3) {
                 // AI 특성 변경
                 ui->ai_personality = (ui->ai_personality == 0) ? 4 : ui->ai_personality - 1;
-                ui_show_ai_difficulty_select(ui);
+                format_personality_option(ui);
+                mark_option_dirty(ui, 3);
             }
             break;
 
@@ -276,11 +261,13 @@ void ui_handle_input(ui_context_t* ui, game_key_t key) {
             if (ui->current_state == UI_STATE_MAIN_MENU && ui->selected_option == 1) {
                 // 게임 속도 변경
                 ui->game_speed_setting = (ui->game_speed_setting + 1) % 3;
-                ui_show_main_menu(ui);
+                format_speed_option(ui);
+                mark_option_dirty(ui, 1);
             } else if (ui->current_state == UI_STATE_AI_DIFFICULTY_SELECT && ui->selected_option == 3) {
                 // AI 특성 변경
                 ui->ai_personality = (ui->ai_personality + 1) % 5;
-                ui_show_ai_difficulty_select(ui);
+                format_personality_option(ui);
+                mark_option_dirty(ui, 3);
             }
             break;
             
@@ -316,19 +303,24 @@ void ui_handle_input(ui_context_t* ui, game_key_t key) {
  * @param ui UI 컨텍스트 포인터
  */
 static void ui_handle_main_menu_selection(ui_context_t* ui) {
-    switch (ui->selected_option) {
-        case 0: // 혼자서 도전
+    switch (ui->options[ui->selected_option].value) {
+        case MAIN_MENU_SINGLE: // 혼자서 도전
             ui->selected_mode = GAME_MODE_SINGLE;
             ui_set_state(ui, UI_STATE_PLAYING);
             break;
-        case 1: // 게임 속도 설정 (좌우 화살표로 변경)
+        case MAIN_MENU_SPEED: // 게임 속도 설정 (좌우 화살표로 변경)
             // Enter는 무시, 좌우 화살표로만 변경
             break;
-        case 2: // AI와 대전
+        case MAIN_MENU_VS_AI: // AI와 대전
             ui_set_state(ui, UI_STATE_AI_DIFFICULTY_SELECT);
             break;
-        case 3: // 종료
+        case MAIN_MENU_RESUME: // 이어하기 (모드는 저장 파일에서 정해짐)
+            ui->resume_requested = true;
+            ui_set_state(ui, UI_STATE_PLAYING);
+            break;
+        case MAIN_MENU_EXIT: // 종료
             // 게임 종료 신호
+            ui->exit_requested = true;
             break;
     }
 }
@@ -389,15 +381,7 @@ void ui_set_state(ui_context_t* ui, ui_state_t state) {
     ui->previous_state = ui->current_state;
     ui->current_state = state;
     ui->selected_option = 0;
-
-    // 상태 변경시 화면을 완전히 정리하기 위해 초기화 플래그 리셋
-    g_ui_initialized = false;
-    g_previous_ui_state = (ui_state_t)-1; // 강제 전체 다시 그리기
-    memset(g_previous_title, 0, sizeof(g_previous_title));
-    memset(g_previous_message, 0, sizeof(g_previous_message));
-    memset(g_previous_options, 0, sizeof(g_previous_options));
-    g_previous_num_options = 0;
-    g_previous_selected_option = -1;
+    mark_dirty(ui, UI_DIRTY_ALL);
 
     // 특히 게임 오버 상태로 전환시 화면 완전 정리
     if (state == UI_STATE_GAME_OVER) {
@@ -417,6 +401,28 @@ void ui_set_state(ui_context_t* ui, ui_state_t state) {
     }
 }
 
+/**
+ * @brief 게임 속도 옵션 문구를 현재 설정으로 갱신합니다
+ * 
+ * @param ui UI 컨텍스트 포인터
+ */
+static void format_speed_option(ui_context_t* ui) {
+    const char* speed_names[] = {"느림", "보통", "빠름"};
+    snprintf(ui->options[1].text, sizeof(ui->options[1].text), 
+             "⚡ 게임 속도: %s ← →", speed_names[ui->game_speed_setting]);
+}
+
+/**
+ * @brief AI 특성 옵션 문구를 현재 설정으로 갱신합니다
+ * 
+ * @param ui UI 컨텍스트 포인터
+ */
+static void format_personality_option(ui_context_t* ui) {
+    const char* personality_names[] = {"균형잡힌", "공격적", "방어적", "신중한", "무모한"};
+    snprintf(ui->options[3].text, sizeof(ui->options[3].text),
+             "🎭 AI 특성: %s ← →", personality_names[ui->ai_personality]);
+}
+
 /**
  * @brief 메인 메뉴를 표시합니다
  * 
@@ -428,21 +434,45 @@ void ui_show_main_menu(ui_context_t* ui) {
     strcpy(ui->title, "🐍 크로스 플랫폼 뱀 게임 🐍");
     strcpy(ui->message, "");
     
-    ui->num_options = 4;
+    ui->num_options = 0;
     strcpy(ui->options[0].text, "🎯 혼자서 도전 (점수 도전 모드)");
+    ui->options[ui->num_options++].value = MAIN_MENU_SINGLE;
     
     // 게임 속도 옵션 (좌우 화살표로 변경 가능)
-    const char* speed_names[] = {"느림", "보통", "빠름"};
-    snprintf(ui->options[1].text, sizeof(ui->options[1].text), 
-             "⚡ 게임 속도: %s ← →", speed_names[ui->game_speed_setting]);
+    format_speed_option(ui);
+    ui->options[ui->num_options++].value = MAIN_MENU_SPEED;
     
     strcpy(ui->options[2].text, "🤖 AI와 대전 (생존 배틀 모드)");
-    strcpy(ui->options[3].text, "🚪 종료");
+    ui->options[ui->num_options++].value = MAIN_MENU_VS_AI;
     
-    ui->options[0].value = 0;
-    ui->options[1].value = 1;
-    ui->options[2].value = 2;
-    ui->options[3].value = 3;
+    // 중단한 게임이 저장되어 있으면 이어하기 옵션 추가
+    if (ui->has_saved_game) {
+        strcpy(ui->options[ui->num_options].text, "⏯️ 이어하기 (중단한 게임)");
+        ui->options[ui->num_options++].value = MAIN_MENU_RESUME;
+    }
+    
+    strcpy(ui->options[ui->num_options].text, "🚪 종료");
+    ui->options[ui->num_options++].value = MAIN_MENU_EXIT;
+    
+    mark_dirty(ui, UI_DIRTY_ALL);
+}
+
+/**
+ * @brief 이어할 수 있는 저장된 게임이 있는지 알립니다
+ * 
+ * 메인 메뉴가 표시 중이면 이어하기 옵션을 바로 추가하거나 뺍니다.
+ * 
+ * @param ui UI 컨텍스트 포인터
+ * @param available 저장된 게임이 있으면 true
+ */
+void ui_set_saved_game_available(ui_context_t* ui, bool available) {
+    if (!ui || ui->has_saved_game == available) return;
+    
+    ui->has_saved_game = available;
+    if (ui->current_state == UI_STATE_MAIN_MENU) {
+        ui->selected_option = 0;
+        ui_show_main_menu(ui);
+    }
 }
 
 /**
@@ -466,9 +496,7 @@ void ui_show_ai_difficulty_select(ui_context_t* ui) {
     strcpy(ui->options[2].text, "😰 어려움 - AI 고수");
     
     // AI 특성 옵션 (좌우 화살표로 변경 가능)
-    const char* personality_names[] = {"균형잡힌", "공격적", "방어적", "신중한", "무모한"};
-    snprintf(ui->options[3].text, sizeof(ui->options[3].text),
-             "🎭 AI 특성: %s ← →", personality_names[ui->ai_personality]);
+    format_personality_option(ui);
     
     strcpy(ui->options[4].text, "⬅️ 뒤로가기");
     
@@ -477,6 +505,8 @@ void ui_show_ai_difficulty_select(ui_context_t* ui) {
     ui->options[2].value = GAME_MODE_VS_AI_HARD;
     ui->options[3].value = -1;
     ui->options[4].value = -1;
+    
+    mark_dirty(ui, UI_DIRTY_ALL);
 }
 
 /**
@@ -484,8 +514,9 @@ void ui_show_ai_difficulty_select(ui_context_t* ui) {
  * 
  * @param ui UI 컨텍스트 포인터
  * @param game 게임 상태 포인터
+ * @param ranking 기록 저장소가 매긴 이번 경기 순위 (NULL이면 표시 안 함)
  */
-void ui_show_game_over(ui_context_t* ui, game_state_t* game) {
+void ui_show_game_over(ui_context_t* ui, game_state_t* game, const score_ranking_t* ranking) {
     if (!ui || !game) return;
     
     strcpy(ui->title, "🎮 게임 종료");
@@ -519,8 +550,8 @@ void ui_show_game_over(ui_context_t* ui, game_state_t* game) {
             rank_emoji = "👑";
         }
         
-        // 게임 시간 계산
-        uint64_t game_time = (platform_get_time_ms() - game->game_start_time) / 1000;
+        // 게임 시간 계산 (게임 시계 기준, 일시정지 제외)
+        uint64_t game_time = game_get_play_time(game) / 1000;
         int minutes = (int)(game_time / 60);
         int seconds = (int)(game_time % 60);
         
@@ -555,10 +586,25 @@ void ui_show_game_over(ui_context_t* ui, game_state_t* game) {
         strcpy(ui->message, "🤝 무승부!\n\n모든 플레이어가 동시에 탈락했습니다.\n다시 도전해보세요!");
     }
     
+    // 같은 모드의 지난 기록 중 이번 경기 순위 (메시지 끝에 한 줄)
+    if (ranking && ranking->rank > 0) {
+        size_t used = strlen(ui->message);
+        if (ranking->rank == 1 && ranking->total > 1) {
+            snprintf(ui->message + used, sizeof(ui->message) - used,
+                     "\n🏅 개인 최고 기록 경신! (%d판 중 1위)", ranking->total);
+        } else {
+            snprintf(ui->message + used, sizeof(ui->message) - used,
+                     "\n🏅 개인 기록: %d판 중 %d위 (최고 %u점)",
+                     ranking->total, ranking->rank, (unsigned)ranking->best_score);
+        }
+    }
+    
     ui->num_options = 2;
     strcpy(ui->options[0].text, "🔄 다시 플레이");
     strcpy(ui->options[1].text, "🏠 메인 메뉴");
     
     ui->options[0].value = 0;
     ui->options[1].value = 1;
+    
+    mark_dirty(ui, UI_DIRTY_ALL);
 }
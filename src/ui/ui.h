@@ -11,6 +11,7 @@
 
 #include "../platform/platform.h"
 #include "../game/game.h"
+#include "../game/score_store.h"
 
 /**
  * @brief UI 상태를 나타내는 열거형
@@ -23,6 +24,17 @@ typedef enum {
     UI_STATE_GAME_OVER             // 게임 종료
 } ui_state_t;
 
+// 다시 그려야 하는 화면 영역 (ui_render는 표시된 영역만 그림)
+#define UI_DIRTY_SCREEN   0x01     // 화면 전체를 지우고 다시 그리기
+#define UI_DIRTY_TITLE    0x02     // 제목 줄
+#define UI_DIRTY_OPTIONS  0x04     // dirty_options에 표시된 옵션 줄
+#define UI_DIRTY_MESSAGE  0x08     // 메시지 영역 (줄 나누기도 다시 계산)
+#define UI_DIRTY_HINTS    0x10     // 하단 조작 안내
+#define UI_DIRTY_ALL      0x1F
+
+#define UI_MAX_OPTIONS 10          // 최대 메뉴 옵션 수
+#define UI_MAX_MESSAGE_LINES 8     // 메시지 영역 줄 수
+
 /**
  * @brief 메뉴 옵션을 나타내는 구조체
  */
@@ -39,14 +51,28 @@ typedef struct {
     ui_state_t previous_state;     // 이전 UI 상태
     int selected_option;           // 선택된 옵션 인덱스
     int num_options;               // 옵션 개수
-    menu_option_t options[10];     // 메뉴 옵션 배열
+    menu_option_t options[UI_MAX_OPTIONS];  // 메뉴 옵션 배열
     char title[128];               // 화면 제목
     char message[512];             // 화면 메시지 (더 긴 메시지 지원)
+    
+    // 변경 추적 (입력 처리와 상태 전환이 표시하고 ui_render가 지움)
+    uint32_t dirty;                // 다시 그릴 영역 (UI_DIRTY_*)
+    uint16_t dirty_options;        // 다시 그릴 옵션 (비트마스크)
+    
+    // 메시지 줄 나누기 결과 (메시지가 바뀔 때만 다시 계산)
+    char message_layout[512];      // 줄바꿈을 널 문자로 바꾼 메시지 사본
+    uint16_t message_lines[UI_MAX_MESSAGE_LINES];  // 각 줄의 시작 위치
+    int message_line_count;        // 표시할 줄 수
     game_mode_t selected_mode;     // 선택된 게임 모드
     
     // 게임 설정
     int game_speed_setting;        // 게임 속도 설정 (0=느림, 1=보통, 2=빠름)
     int ai_personality;            // AI 특성 설정 (0=균형, 1=공격적, 2=방어적, 3=신중, 4=무모)
+    
+    // 메인 메뉴 요청 (main이 확인 후 처리)
+    bool has_saved_game;           // 이어하기 옵션 표시 여부
+    bool resume_requested;         // 저장된 게임 이어하기 선택됨
+    bool exit_requested;           // 종료 선택됨
 } ui_context_t;
 
 // 함수 선언
@@ -57,8 +83,9 @@ void ui_render(ui_context_t* ui);
 void ui_handle_input(ui_context_t* ui, game_key_t key);
 void ui_set_state(ui_context_t* ui, ui_state_t state);
 void ui_show_main_menu(ui_context_t* ui);
+void ui_set_saved_game_available(ui_context_t* ui, bool available);
 void ui_show_game_mode_select(ui_context_t* ui);
 void ui_show_ai_difficulty_select(ui_context_t* ui);
-void ui_show_game_over(ui_context_t* ui, game_state_t* game);
+void ui_show_game_over(ui_context_t* ui, game_state_t* game, const score_ranking_t* ranking);
 
 #endif // UI_H
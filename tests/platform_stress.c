@@ -0,0 +1,411 @@
+/**
+ * @file platform_stress.c
+ * @brief 스레드 기본 요소와 스레드 풀 스트레스 테스트
+ *
+ * 여러 스레드가 동시에 조건 변수, 세마포어, 원자적 연산, 스레드 로컬 저장소,
+ * 스레드 풀 퓨처를 두드린 뒤 결과가 정확히 맞는지 확인합니다.
+ * 하나라도 틀리면 실패한 항목을 출력하고 0이 아닌 값으로 끝납니다 (ctest에서 실행).
+ *
+ * 사용법: platform_stress [스레드 수]   (기본: CPU 수와 4 중 큰 값)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "platform/platform.h"
+#include "platform/thread_pool.h"
+
+#define STRESS_MAX_THREADS 64
+#define QUEUE_CAPACITY 16              // 생산자-소비자 큐 크기 (작을수록 대기가 잦음)
+#define ITEMS_PER_PRODUCER 20000
+#define ATOMIC_ITERATIONS 200000
+#define SEMAPHORE_PERMITS 3
+#define SEMAPHORE_ITERATIONS 20000
+#define TLS_ITERATIONS 10000
+#define POOL_TASKS 20000
+
+static int g_failures = 0;
+
+static void check(bool condition, const char* name) {
+    if (!condition) {
+        fprintf(stderr, "실패: %s\n", name);
+        g_failures++;
+    }
+}
+
+/**
+ * @brief 여러 스레드를 같은 함수로 실행하고 모두 끝날 때까지 기다립니다
+ */
+static void run_threads(int count, thread_func_t func, void* arg) {
+    thread_handle_t threads[STRESS_MAX_THREADS];
+    for (int i = 0; i < count; i++) {
+        threads[i] = platform_create_thread(func, arg);
+        check(threads[i].handle != NULL, "스레드 생성");
+    }
+    for (int i = 0; i < count; i++) {
+        if (threads[i].handle) platform_join_thread(threads[i]);
+    }
+}
+
+// ========== 조건 변수: 크기가 작은 생산자-소비자 큐 ==========
+
+typedef struct {
+    mutex_handle_t mutex;
+    cond_handle_t not_empty;
+    cond_handle_t not_full;
+    int64_t items[QUEUE_CAPACITY];
+    int head;
+    int count;
+    int producers_left;
+    volatile int32_t next_producer;
+    volatile int64_t consumed_sum;
+    volatile int32_t consumed_count;
+} bounded_queue_t;
+
+static void* producer_main(void* arg) {
+    bounded_queue_t* queue = (bounded_queue_t*)arg;
+    int64_t id = platform_atomic_fetch_add(&queue->next_producer, 1);
+
+    for (int64_t i = 1; i <= ITEMS_PER_PRODUCER; i++) {
+        platform_lock_mutex(queue->mutex);
+        while (queue->count == QUEUE_CAPACITY) {
+            platform_cond_wait(queue->not_full, queue->mutex);
+        }
+        queue->items[(queue->head + queue->count) % QUEUE_CAPACITY] = id * ITEMS_PER_PRODUCER + i;
+        queue->count++;
+        platform_cond_signal(queue->not_empty);
+        platform_unlock_mutex(queue->mutex);
+    }
+
+    // 마지막 생산자는 기다리는 소비자를 모두 깨워 끝내게 함
+    platform_lock_mutex(queue->mutex);
+    if (--queue->producers_left == 0) {
+        platform_cond_broadcast(queue->not_empty);
+    }
+    platform_unlock_mutex(queue->mutex);
+    return NULL;
+}
+
+static void* consumer_main(void* arg) {
+    bounded_queue_t* queue = (bounded_queue_t*)arg;
+    int64_t sum = 0;
+    int32_t count = 0;
+
+    for (;;) {
+        platform_lock_mutex(queue->mutex);
+        while (queue->count == 0 && queue->producers_left > 0) {
+            // 시간 제한 대기도 함께 사용 (신호를 놓쳐도 다시 확인)
+            platform_cond_timed_wait(queue->not_empty, queue->mutex, 5);
+        }
+        if (queue->count == 0) {
+            platform_unlock_mutex(queue->mutex);
+            break;
+        }
+        int64_t item = queue->items[queue->head];
+        queue->head = (queue->head + 1) % QUEUE_CAPACITY;
+        queue->count--;
+        platform_cond_signal(queue->not_full);
+        platform_unlock_mutex(queue->mutex);
+
+        sum += item;
+        count++;
+    }
+
+    platform_atomic_fetch_add64(&queue->consumed_sum, sum);
+    platform_atomic_fetch_add(&queue->consumed_count, count);
+    return NULL;
+}
+
+typedef struct {
+    bounded_queue_t* queue;
+    volatile int32_t started;
+    int producers;
+} queue_test_t;
+
+static void* queue_role_main(void* arg) {
+    queue_test_t* test = (queue_test_t*)arg;
+    int index = platform_atomic_fetch_add(&test->started, 1);
+    return index < test->producers ? producer_main(test->queue) : consumer_main(test->queue);
+}
+
+static void test_condition_variables(int threads) {
+    bounded_queue_t queue = {0};
+    queue.mutex = platform_create_mutex();
+    queue.not_empty = platform_create_cond();
+    queue.not_full = platform_create_cond();
+
+    int producers = threads / 2 > 0 ? threads / 2 : 1;
+    int consumers = threads - producers > 0 ? threads - producers : 1;
+    queue.producers_left = producers;
+
+    queue_test_t test = {&queue, 0, producers};
+    run_threads(producers + consumers, queue_role_main, &test);
+
+    // 생산자 p는 p * N + 1 ... p * N + N을 만듦
+    int64_t n = ITEMS_PER_PRODUCER;
+    int64_t expected_sum = 0;
+    for (int64_t p = 0; p < producers; p++) {
+        expected_sum += p * n * n + n * (n + 1) / 2;
+    }
+    check(queue.consumed_count == producers * ITEMS_PER_PRODUCER, "조건 변수: 소비한 항목 수");
+    check(queue.consumed_sum == expected_sum, "조건 변수: 소비한 항목 합");
+    check(queue.count == 0, "조건 변수: 큐가 비어야 함");
+
+    platform_destroy_cond(queue.not_full);
+    platform_destroy_cond(queue.not_empty);
+    platform_destroy_mutex(queue.mutex);
+}
+
+// ========== 세마포어: 동시 진입 수 제한 ==========
+
+typedef struct {
+    semaphore_handle_t permits;
+    volatile int32_t inside;
+    volatile int32_t max_inside;
+    volatile int32_t entries;
+} semaphore_test_t;
+
+static void* semaphore_main(void* arg) {
+    semaphore_test_t* test = (semaphore_test_t*)arg;
+
+    for (int i = 0; i < SEMAPHORE_ITERATIONS; i++) {
+        // 절반은 try_wait로 들어가 보고 실패하면 기다림
+        if ((i & 1) == 0 || !platform_semaphore_try_wait(test->permits)) {
+            platform_semaphore_wait(test->permits);
+        }
+
+        int32_t inside = platform_atomic_fetch_add(&test->inside, 1) + 1;
+        int32_t seen = platform_atomic_load(&test->max_inside);
+        while (inside > seen && !platform_atomic_compare_exchange(&test->max_inside, &seen, inside)) {
+        }
+        platform_atomic_fetch_add(&test->entries, 1);
+        platform_atomic_fetch_add(&test->inside, -1);
+
+        platform_semaphore_post(test->permits);
+    }
+    return NULL;
+}
+
+static void test_semaphores(int threads) {
+    semaphore_test_t test = {0};
+    test.permits = platform_create_semaphore(SEMAPHORE_PERMITS);
+    check(test.permits.handle != NULL, "세마포어 생성");
+
+    run_threads(threads, semaphore_main, &test);
+
+    check(test.entries == threads * SEMAPHORE_ITERATIONS, "세마포어: 진입 횟수");
+    check(test.max_inside <= SEMAPHORE_PERMITS, "세마포어: 동시 진입 수가 허가 수를 넘음");
+    check(test.inside == 0, "세마포어: 모두 빠져나와야 함");
+
+    // 허가가 모두 돌아왔는지 확인
+    int available = 0;
+    while (platform_semaphore_try_wait(test.permits)) available++;
+    check(available == SEMAPHORE_PERMITS, "세마포어: 남은 허가 수");
+
+    platform_destroy_semaphore(test.permits);
+}
+
+// ========== 원자적 연산 ==========
+
+typedef struct {
+    volatile int32_t counter;
+    volatile int64_t counter64;
+    volatile int32_t cas_counter;
+    volatile int32_t lock;             // exchange로 만든 스핀 잠금
+    int64_t guarded;                   // lock으로만 보호하는 일반 변수
+} atomic_test_t;
+
+static void* atomic_main(void* arg) {
+    atomic_test_t* test = (atomic_test_t*)arg;
+
+    for (int i = 0; i < ATOMIC_ITERATIONS; i++) {
+        platform_atomic_fetch_add(&test->counter, 1);
+        platform_atomic_fetch_add64(&test->counter64, 3);
+
+        int32_t expected = platform_atomic_load(&test->cas_counter);
+        while (!platform_atomic_compare_exchange(&test->cas_counter, &expected, expected + 1)) {
+        }
+
+        if ((i & 15) == 0) {
+            while (platform_atomic_exchange(&test->lock, 1) != 0) {
+            }
+            test->guarded++;
+            platform_atomic_store(&test->lock, 0);
+        }
+    }
+    return NULL;
+}
+
+static void test_atomics(int threads) {
+    atomic_test_t test = {0};
+    run_threads(threads, atomic_main, &test);
+
+    int64_t total = (int64_t)threads * ATOMIC_ITERATIONS;
+    check(platform_atomic_load(&test.counter) == total, "원자적 연산: fetch_add");
+    check(platform_atomic_load64(&test.counter64) == total * 3, "원자적 연산: fetch_add64");
+    check(platform_atomic_load(&test.cas_counter) == total, "원자적 연산: compare_exchange");
+    check(test.guarded == (int64_t)threads * ((ATOMIC_ITERATIONS + 15) / 16), "원자적 연산: exchange 잠금");
+
+    platform_atomic_store64(&test.counter64, -1);
+    check(platform_atomic_load64(&test.counter64) == -1, "원자적 연산: store64");
+}
+
+// ========== 스레드 로컬 저장소 ==========
+
+typedef struct {
+    tls_key_t key;
+    volatile int32_t next_id;
+    volatile int32_t mismatches;
+} tls_test_t;
+
+static void* tls_main(void* arg) {
+    tls_test_t* test = (tls_test_t*)arg;
+    intptr_t id = platform_atomic_fetch_add(&test->next_id, 1) + 1;
+
+    check(platform_tls_get(test->key) == NULL, "스레드 로컬: 새 스레드의 값은 NULL");
+    for (int i = 0; i < TLS_ITERATIONS; i++) {
+        platform_tls_set(test->key, (void*)(id * 100000 + i));
+        if (platform_tls_get(test->key) != (void*)(id * 100000 + i)) {
+            platform_atomic_fetch_add(&test->mismatches, 1);
+        }
+    }
+    return NULL;
+}
+
+static void test_thread_local(int threads) {
+    tls_test_t test = {0};
+    test.key = platform_tls_create();
+    check(test.key.handle != NULL, "스레드 로컬: 키 생성");
+
+    platform_tls_set(test.key, &test);
+    run_threads(threads, tls_main, &test);
+
+    check(test.mismatches == 0, "스레드 로컬: 다른 스레드의 값이 보임");
+    check(platform_tls_get(test.key) == &test, "스레드 로컬: 주 스레드의 값이 바뀜");
+    platform_tls_destroy(test.key);
+}
+
+// ========== 스레드 풀과 퓨처 ==========
+
+static void* square_task(void* arg) {
+    intptr_t value = (intptr_t)arg;
+    return (void*)(value * value);
+}
+
+typedef struct {
+    thread_pool_t* pool;
+    volatile int32_t next_submitter;
+    volatile int32_t wrong_results;
+    volatile int32_t failed_submits;
+} pool_test_t;
+
+/**
+ * @brief 여러 스레드가 같은 풀에 동시에 제출하고 결과를 확인합니다
+ *
+ * 일부 퓨처는 결과를 기다리지 않고 바로 해제해 작업 도중 해제도 함께 시험합니다.
+ */
+static void* submitter_main(void* arg) {
+    pool_test_t* test = (pool_test_t*)arg;
+    intptr_t base = (intptr_t)platform_atomic_fetch_add(&test->next_submitter, 1) * POOL_TASKS;
+    future_t* futures[64];
+
+    for (int start = 0; start < POOL_TASKS; start += 64) {
+        for (int i = 0; i < 64; i++) {
+            futures[i] = thread_pool_submit(test->pool, square_task, (void*)(base + start + i));
+            if (!futures[i]) platform_atomic_fetch_add(&test->failed_submits, 1);
+        }
+        for (int i = 0; i < 64; i++) {
+            if (!futures[i]) continue;
+            if (i % 8 == 7) {
+                future_release(futures[i]);
+                continue;
+            }
+            intptr_t value = base + start + i;
+            if ((intptr_t)future_get(futures[i]) != value * value || !future_is_ready(futures[i])) {
+                platform_atomic_fetch_add(&test->wrong_results, 1);
+            }
+            future_release(futures[i]);
+        }
+    }
+    return NULL;
+}
+
+static void test_thread_pool(int threads) {
+    pool_test_t test = {0};
+    test.pool = thread_pool_create(threads);
+    check(test.pool != NULL, "스레드 풀: 생성");
+    if (!test.pool) return;
+    check(thread_pool_size(test.pool) == threads, "스레드 풀: 작업자 수");
+
+    int submitters = threads < 4 ? threads : 4;
+    run_threads(submitters, submitter_main, &test);
+
+    check(test.failed_submits == 0, "스레드 풀: 제출 실패");
+    check(test.wrong_results == 0, "스레드 풀: 퓨처 결과");
+
+    // 제출한 작업이 남아 있어도 destroy는 모두 실행한 뒤 끝나야 함
+    for (int i = 0; i < 1000; i++) {
+        future_t* future = thread_pool_submit(test.pool, square_task, (void*)(intptr_t)i);
+        future_release(future);
+    }
+    thread_pool_destroy(test.pool);
+}
+
+// ========== 스레드 상태 ==========
+
+static void* wait_for_release(void* arg) {
+    semaphore_handle_t* release = (semaphore_handle_t*)arg;
+    platform_semaphore_wait(*release);
+    return NULL;
+}
+
+static void test_thread_running(void) {
+    semaphore_handle_t release = platform_create_semaphore(0);
+    thread_handle_t thread = platform_create_thread(wait_for_release, &release);
+    check(platform_thread_running(thread), "스레드 상태: 실행 중");
+
+    platform_semaphore_post(release);
+    uint64_t deadline = platform_get_time_us() + 2000000;
+    while (platform_thread_running(thread) && platform_get_time_us() < deadline) {
+        platform_sleep(1);
+    }
+    check(!platform_thread_running(thread), "스레드 상태: 끝난 뒤에도 실행 중");
+
+    platform_join_thread(thread);
+    platform_destroy_semaphore(release);
+}
+
+typedef struct {
+    const char* name;
+    void (*run)(int threads);
+} stress_case_t;
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? atoi(argv[1]) : platform_cpu_count();
+    if (threads < 4) threads = 4;
+    if (threads > STRESS_MAX_THREADS) threads = STRESS_MAX_THREADS;
+
+    static const stress_case_t cases[] = {
+        {"조건 변수", test_condition_variables},
+        {"세마포어", test_semaphores},
+        {"원자적 연산", test_atomics},
+        {"스레드 로컬 저장소", test_thread_local},
+        {"스레드 풀", test_thread_pool},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        int before = g_failures;
+        uint64_t start = platform_get_time_us();
+        cases[i].run(threads);
+        printf("%-20s 스레드 %d개  %s (%.1fms)\n", cases[i].name, threads,
+               g_failures == before ? "통과" : "실패",
+               (double)(platform_get_time_us() - start) / 1000.0);
+    }
+    test_thread_running();
+
+    if (g_failures > 0) {
+        printf("실패 %d건\n", g_failures);
+        return 1;
+    }
+    printf("모두 통과\n");
+    return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file replay_roundtrip.c
+ * @brief 리플레이 기록 → 재생 일치 테스트
+ *
+ * 시드를 바꿔 가며 AI끼리의 대전을 가상 시계로 기록한 뒤,
+ * replay_play로 game_update를 다시 실행한 결과와 탐색 리더로 종료 틱과
+ * 중간 틱을 찾아간 상태가 원래 게임의 game_state_hash와 같은지 확인합니다.
+ * 하나라도 다르면 실패한 항목을 출력하고 0이 아닌 값으로 끝납니다 (ctest에서 실행).
+ *
+ * 사용법: replay_roundtrip [게임 수]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform/platform.h"
+#include "game/game.h"
+#include "game/ai.h"
+#include "game/replay.h"
+
+#define ROUNDTRIP_DIRECTORY "roundtrip_replays"
+#define ROUNDTRIP_DEFAULT_GAMES 24
+#define ROUNDTRIP_MAX_TICKS 4000       // 끝나지 않는 게임도 이 틱에서 기록을 마침
+#define REPLAY_SUFFIX ".snkr"
+
+static int g_failures = 0;
+
+static void check(bool condition, uint32_t seed, const char* name) {
+    if (!condition) {
+        fprintf(stderr, "실패 (시드 %u): %s\n", (unsigned)seed, name);
+        g_failures++;
+    }
+}
+
+/**
+ * @brief 디렉터리 안의 리플레이 파일 이름을 찾거나 지웁니다
+ */
+typedef struct {
+    char path[256];                // 찾은 파일 경로 (마지막 하나)
+    bool remove_all;               // true면 찾은 파일을 모두 지움
+} replay_scan_t;
+
+static void scan_entry(const char* name, void* user) {
+    replay_scan_t* scan = (replay_scan_t*)user;
+    size_t length = strlen(name);
+    if (length < strlen(REPLAY_SUFFIX) || strcmp(name + length - strlen(REPLAY_SUFFIX), REPLAY_SUFFIX) != 0) {
+        return;
+    }
+    snprintf(scan->path, sizeof(scan->path), "%s/%s", ROUNDTRIP_DIRECTORY, name);
+    if (scan->remove_all) remove(scan->path);
+}
+
+static void clear_directory(void) {
+    replay_scan_t scan = {"", true};
+    platform_list_directory(ROUNDTRIP_DIRECTORY, scan_entry, &scan);
+}
+
+/**
+ * @brief 게임 하나를 기록하고 세 가지 재생 경로로 검증합니다
+ */
+static void roundtrip(uint32_t seed, game_mode_t mode, int personality) {
+    static game_state_t game;
+    static game_state_t replayed;
+
+    clear_directory();
+
+    game_clock_t clock;
+    game_clock_init(&clock, GAME_CLOCK_VIRTUAL);
+    if (!game_init_with_seed(&game, mode, &clock, seed)) {
+        check(false, seed, "게임 초기화");
+        return;
+    }
+    game.players[0].type = PLAYER_AI_MEDIUM;
+    game.recorder = replay_recorder_start(&game, personality, ROUNDTRIP_DIRECTORY);
+    check(game.recorder != NULL, seed, "기록 시작");
+
+    // 원래 게임을 진행하며 중간 틱의 해시를 남겨 둠 (키프레임 사이에서 탐색 확인용)
+    uint32_t middle_tick = 0;
+    uint64_t middle_hash = 0;
+    while (game.tick_count < ROUNDTRIP_MAX_TICKS) {
+        if (game.tick_count == REPLAY_KEYFRAME_INTERVAL + 37) {
+            middle_tick = game.tick_count;
+            middle_hash = game_state_hash(&game);
+        }
+        ai_update_players(&game, personality);
+        game_clock_advance_us(&game.clock, (uint64_t)game.game_speed * 1000);
+        if (!game_update(&game)) break;
+    }
+
+    uint32_t final_tick = game.tick_count;
+    uint64_t final_hash = game_state_hash(&game);
+    check(replay_recorder_finish(game.recorder, &game), seed, "기록 마침");
+    game.recorder = NULL;
+    game_cleanup(&game);
+
+    replay_scan_t scan = {"", false};
+    platform_list_directory(ROUNDTRIP_DIRECTORY, scan_entry, &scan);
+    if (scan.path[0] == '\0') {
+        check(false, seed, "리플레이 파일이 없음");
+        return;
+    }
+
+    // 처음부터 game_update로 다시 실행
+    replay_t replay;
+    if (replay_load(scan.path, &replay)) {
+        check(replay.final_tick == final_tick, seed, "기록된 종료 틱");
+        check(replay.final_hash == final_hash, seed, "기록된 종료 해시");
+        check(replay_play(&replay, &replayed), seed, "replay_play 해시 불일치");
+        check(replayed.tick_count == final_tick && game_state_hash(&replayed) == final_hash,
+              seed, "replay_play 종료 상태");
+        game_cleanup(&replayed);
+        replay_free(&replay);
+    } else {
+        check(false, seed, "replay_load");
+    }
+
+    // 키프레임에서 시작하는 탐색
+    replay_reader_t* reader = replay_reader_open(scan.path);
+    if (reader) {
+        check(replay_reader_final_tick(reader) == final_tick, seed, "리더 종료 틱");
+        check(replay_reader_seek(reader, final_tick), seed, "종료 틱 탐색");
+        check(game_state_hash(replay_reader_state(reader)) == final_hash, seed, "종료 틱 상태 해시");
+        if (middle_tick > 0) {
+            check(replay_reader_seek(reader, middle_tick), seed, "중간 틱 탐색");
+            check(game_state_hash(replay_reader_state(reader)) == middle_hash, seed, "중간 틱 상태 해시");
+        }
+        replay_reader_close(reader);
+    } else {
+        check(false, seed, "replay_reader_open");
+    }
+
+    remove(scan.path);
+}
+
+int main(int argc, char** argv) {
+    int games = argc > 1 ? atoi(argv[1]) : ROUNDTRIP_DEFAULT_GAMES;
+    if (games <= 0) games = ROUNDTRIP_DEFAULT_GAMES;
+
+    static const game_mode_t modes[] = {
+        GAME_MODE_SINGLE, GAME_MODE_VS_AI_EASY, GAME_MODE_VS_AI_MEDIUM, GAME_MODE_VS_AI_HARD
+    };
+
+    for (int i = 0; i < games; i++) {
+        roundtrip(1000u + (uint32_t)i * 7919u, modes[i % 4], i % 5);
+    }
+
+    if (g_failures > 0) {
+        printf("게임 %d개 중 실패 %d건\n", games, g_failures);
+        return 1;
+    }
+    printf("게임 %d개 모두 재현됨\n", games);
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file screen_diff.c
+ * @brief 가상 화면 합성기의 ANSI 차분 출력 테스트
+ *
+ * 백 버퍼에 그린 뒤 screen_flush_ansi가 내보내는 바이트를 그대로 모아
+ * 기대한 이스케이프 시퀀스와 비교합니다. 하나라도 다르면 실제 출력을 보여 주고
+ * 0이 아닌 값으로 끝납니다 (ctest에서 실행).
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "platform/platform.h"
+#include "platform/screen.h"
+
+static char g_output[65536];
+static size_t g_output_len = 0;
+static int g_failures = 0;
+
+static void collect_output(const char* data, size_t len) {
+    if (g_output_len + len > sizeof(g_output)) len = sizeof(g_output) - g_output_len;
+    memcpy(g_output + g_output_len, data, len);
+    g_output_len += len;
+}
+
+/**
+ * @brief 출력한 바이트를 사람이 읽을 수 있게 보여 줍니다 (ESC는 \e)
+ */
+static void print_escaped(const char* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)data[i];
+        if (c == 0x1b) fputs("\\e", stderr);
+        else if (c < 0x20 || c >= 0x7f) fprintf(stderr, "\\x%02x", c);
+        else fputc(c, stderr);
+    }
+}
+
+/**
+ * @brief 화면을 출력하고 내보낸 바이트가 expected와 같은지 확인합니다
+ */
+static void expect_flush(const char* name, const char* expected) {
+    g_output_len = 0;
+    size_t total = screen_flush_ansi(collect_output);
+
+    size_t expected_len = strlen(expected);
+    if (total != g_output_len || g_output_len != expected_len || memcmp(g_output, expected, expected_len) != 0) {
+        fprintf(stderr, "실패: %s\n  기대: ", name);
+        print_escaped(expected, expected_len);
+        fprintf(stderr, "\n  실제: ");
+        print_escaped(g_output, g_output_len);
+        fprintf(stderr, "\n");
+        g_failures++;
+    }
+}
+
+int main(void) {
+    screen_init();
+
+    // 처음 출력은 터미널 내용을 모르므로 전체 지우기부터
+    expect_flush("첫 출력", "\033[0m\033[2J");
+    expect_flush("변경 없음", "");
+
+    // 셀 하나: 절대 위치 이동, 색상, 글자
+    platform_set_color(COLOR_RED);
+    platform_print_at(5, 3, "A");
+    expect_flush("셀 하나 변경", "\033[4;6H\033[31mA");
+    platform_print_at(5, 3, "A");
+    expect_flush("같은 내용 다시 그리기", "");
+
+    // 두 칸 글자는 첫 칸에서 한 번만 출력
+    platform_set_color(COLOR_WHITE);
+    platform_print_at(0, 5, "한");
+    expect_flush("두 칸 글자", "\033[6;1H\033[37m한");
+
+    // 빈 칸 구간: 4칸 이상은 ECH, 줄 끝까지는 EL, 3칸 이하는 공백
+    platform_print_at(10, 7, "ABCDEFGHIJ");
+    expect_flush("빈 칸 구간 준비", "\033[8;11H\033[37mABCDEFGHIJ");
+    platform_clear_area(11, 7, 6, 1);
+    expect_flush("빈 칸 6개", "\033[8;12H\033[6X");
+    platform_clear_line(7);
+    expect_flush("줄 끝까지 빈 칸", "\033[8;11H\033[K");
+
+    platform_print_at(0, 9, "XYZW");
+    expect_flush("짧은 빈 칸 준비", "\033[10;1H\033[37mXYZW");
+    platform_clear_area(1, 9, 2, 1);
+    expect_flush("빈 칸 2개", "\033[10;2H  ");
+
+    // 잘못된 UTF-8은 '?'로 바뀌어 나감
+    platform_print_at(0, 11, "a\xff" "b\xe4\xb8");
+    expect_flush("잘못된 UTF-8", "\033[12;1H\033[37ma?b?");
+
+    if (g_failures > 0) {
+        printf("실패 %d건\n", g_failures);
+        return 1;
+    }
+    printf("모두 통과\n");
+    return 0;
+}
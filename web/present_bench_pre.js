@@ -0,0 +1,26 @@
+// present_bench용 최소 document (node에는 DOM이 없음)
+// platform_web.c의 ensure_screen_rows와 platform_present_buffer가 쓰는 기능만 흉내 냅니다.
+(function () {
+    if (typeof document !== 'undefined') return;
+
+    function createElement() {
+        return {
+            style: {},
+            textContent: '',
+            isConnected: true,
+            children: [],
+            appendChild: function (child) {
+                this.children.push(child);
+                return child;
+            }
+        };
+    }
+
+    var output = createElement();
+    globalThis.document = {
+        getElementById: function (id) {
+            return id === 'output' ? output : null;
+        },
+        createElement: createElement
+    };
+})();